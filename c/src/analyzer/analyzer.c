@@ -1,14 +1,21 @@
 #include "analyzer.h"
+#include "lexer.h"
+#include "arena.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <stdarg.h>
+#include <stdint.h>
 
 typedef struct {
     char *buffer;
     size_t size;
     size_t capacity;
+    int fixed;               // buffer belongs to the caller and never grows
+    OutputSink sink;         // Full buffers are handed here instead of growing
+    void *context;
+    int stopped;             // A fixed buffer ran out of room, or the sink said stop
 } StringBuilder;
 
 StringBuilder* sb_create(size_t initial_capacity) {
@@ -24,12 +31,37 @@ StringBuilder* sb_create(size_t initial_capacity) {
     sb->buffer[0] = '\0';
     sb->size = 0;
     sb->capacity = initial_capacity;
+    sb->fixed = 0;
+    sb->sink = NULL;
+    sb->context = NULL;
+    sb->stopped = 0;
     return sb;
 }
 
+// Hand what is buffered to the sink and start over
+static void sb_flush(StringBuilder *sb) {
+    if (sb->size && !sb->stopped && sb->sink(sb->context, sb->buffer, sb->size) != 0) {
+        sb->stopped = 1;
+    }
+    sb->size = 0;
+    sb->buffer[0] = '\0';
+}
+
 void sb_append(StringBuilder *sb, const char *str) {
+    if (sb->stopped) return;
     size_t len = strlen(str);
-    
+
+    if (sb->sink && sb->size + len >= sb->capacity) {
+        sb_flush(sb);
+        if (len >= sb->capacity) {
+            if (!sb->stopped && sb->sink(sb->context, str, len) != 0) sb->stopped = 1;
+            return;
+        }
+    }
+    if (sb->fixed && sb->size + len >= sb->capacity) {
+        sb->stopped = 1;
+        return;
+    }
     while (sb->size + len >= sb->capacity) {
         sb->capacity *= 2;
         char *new_buffer = realloc(sb->buffer, sb->capacity);
@@ -57,13 +89,33 @@ char* sb_to_string(StringBuilder *sb) {
 }
 
 // ============================================================================
-// LEXER: Tokenize source code into AST
+// TOKENS: AST token storage
 // ============================================================================
 
-static void ast_add_token(AST *ast, TokenType type, const char *start, size_t length, int line) {
+AST* ast_create(size_t size) {
+    AST *ast = malloc(sizeof(AST));
+    if (!ast) return NULL;
+
+    // At most one token per byte plus EOF, so the array never has to grow.
+    // Real inputs use a small fraction of that bound, so it is not
+    // prefaulted: only the pages tokens are written to get backed.
+    ast->capacity = size + 1;
+    ast->count = 0;
+    ast->deps = NULL;
+    ast->dep_count = 0;
+    ast->dep_capacity = 0;
+    ast->tokens = large_alloc(ast->capacity * sizeof(Token), 0);
+    if (!ast->tokens) {
+        free(ast);
+        return NULL;
+    }
+    return ast;
+}
+
+void ast_add_token(AST *ast, TokenType type, const char *start, size_t length, int line) {
     if (ast->count >= ast->capacity) {
         ast->capacity *= 2;
-        Token *new_tokens = realloc(ast->tokens, ast->capacity * sizeof(Token));
+        Token *new_tokens = large_grow(ast->tokens, ast->capacity * sizeof(Token));
         if (!new_tokens) return;
         ast->tokens = new_tokens;
     }
@@ -75,22 +127,157 @@ static void ast_add_token(AST *ast, TokenType type, const char *start, size_t le
     ast->count++;
 }
 
+// ============================================================================
+// DEPENDENCIES: Collect module specifiers while lexing
+// ============================================================================
+
+static int is_ident_char(char c) {
+    return isalnum((unsigned char)c) || c == '_' || c == '$';
+}
+
+static int word_is(const char *word, size_t len, const char *keyword) {
+    return len == strlen(keyword) && strncmp(word, keyword, len) == 0;
+}
+
+// Identifier ending right before pos (whitespace skipped)
+static const char* word_before(const char *source, const char *pos, size_t *len) {
+    const char *p = pos;
+    while (p > source && isspace((unsigned char)p[-1])) p--;
+    const char *word_end = p;
+    while (p > source && is_ident_char(p[-1])) p--;
+    *len = word_end - p;
+    return p;
+}
+
+// Identifier starting at or after pos (whitespace skipped)
+static const char* word_after(const char *pos, const char *end, size_t *len) {
+    const char *p = pos;
+    while (p < end && isspace((unsigned char)*p)) p++;
+    const char *word = p;
+    while (p < end && is_ident_char(*p)) p++;
+    *len = p - word;
+    return word;
+}
+
+static void ast_add_dep(AST *ast, DepKind kind, int type_only, const char *source,
+                        const char *literal, size_t literal_length, int line) {
+    if (ast->dep_count >= ast->dep_capacity) {
+        size_t capacity = ast->dep_capacity ? ast->dep_capacity * 2 : 8;
+        ModuleDep *new_deps = realloc(ast->deps, capacity * sizeof(ModuleDep));
+        if (!new_deps) return;
+        ast->deps = new_deps;
+        ast->dep_capacity = capacity;
+    }
+
+    ModuleDep *dep = &ast->deps[ast->dep_count++];
+    dep->kind = kind;
+    dep->type_only = type_only;
+    dep->specifier = literal + 1;
+    dep->length = literal_length - 2;
+    dep->start = literal - source;
+    dep->end = dep->start + literal_length;
+    dep->line = line;
+}
+
+// Called on an identifier start: opens a statement on import/export keywords
+void dep_note_keyword(DepState *ds, const char *source, const char *ptr, const char *end) {
+    if (ptr > source && (is_ident_char(ptr[-1]) || ptr[-1] == '.')) return;
+
+    size_t len, next_len;
+    const char *word = word_after(ptr, end, &len);
+    DepKind kind;
+    if (word_is(word, len, "import")) {
+        kind = DEP_IMPORT;
+    } else if (word_is(word, len, "export")) {
+        kind = DEP_EXPORT_FROM;
+    } else {
+        return;
+    }
+
+    // import("x") and import.meta are expressions, not statements
+    const char *rest = word + len;
+    while (rest < end && isspace((unsigned char)*rest)) rest++;
+    if (kind == DEP_IMPORT && rest < end && (*rest == '(' || *rest == '.')) return;
+
+    ds->pending = 1;
+    ds->kind = kind;
+    ds->type_only = 0;
+
+    // "import type X from" is type-only, "import type from" imports a binding named type
+    const char *next = word_after(rest, end, &next_len);
+    if (word_is(next, next_len, "type")) {
+        const char *after = next + next_len;
+        while (after < end && isspace((unsigned char)*after)) after++;
+        const char *follow = word_after(after, end, &len);
+        ds->type_only = after < end && *after != ',' && !word_is(follow, len, "from");
+    }
+}
+
+// Called when a string literal closes in code context
+void dep_note_string(AST *ast, DepState *ds, const char *source, const char *literal,
+                     const char *literal_end, const char *end, int line) {
+    size_t literal_length = literal_end - literal;
+    if (literal_length < 2) return;
+
+    size_t len;
+    const char *word;
+
+    // require("x") / import("x")
+    const char *p = literal;
+    while (p > source && isspace((unsigned char)p[-1])) p--;
+    if (p > source && p[-1] == '(') {
+        word = word_before(source, p - 1, &len);
+        if ((word_is(word, len, "require") || word_is(word, len, "import")) &&
+            (word == source || word[-1] != '.')) {
+            const char *q = literal_end;
+            while (q < end && isspace((unsigned char)*q)) q++;
+            if (q >= end || (*q != ')' && *q != ',')) return;
+
+            // Template literals with substitutions are not static specifiers
+            if (*literal == '`') {
+                for (const char *c = literal; c + 1 < literal_end; c++) {
+                    if (c[0] == '$' && c[1] == '{') return;
+                }
+            }
+
+            DepKind kind = word_is(word, len, "require") ? DEP_REQUIRE : DEP_DYNAMIC_IMPORT;
+            ast_add_dep(ast, kind, 0, source, literal, literal_length, line);
+            return;
+        }
+    }
+
+    // import ... from "x" / export ... from "x" / import "x"
+    if (ds->pending && *literal != '`') {
+        word = word_before(source, literal, &len);
+        if (word_is(word, len, "from") || (ds->kind == DEP_IMPORT && word_is(word, len, "import"))) {
+            ast_add_dep(ast, ds->kind, ds->type_only, source, literal, literal_length, line);
+        }
+        ds->pending = 0;
+    }
+}
+
+const char* dep_kind_name(DepKind kind) {
+    switch (kind) {
+        case DEP_IMPORT:         return "import";
+        case DEP_EXPORT_FROM:    return "export";
+        case DEP_REQUIRE:        return "require";
+        case DEP_DYNAMIC_IMPORT: return "dynamic-import";
+    }
+    return "unknown";
+}
+
+// ============================================================================
+// LEXER: Tokenize source code into AST
+// ============================================================================
+
 AST* lex(const char *source, size_t size) {
     if (!source || size == 0) {
         return NULL;
     }
     
-    AST *ast = malloc(sizeof(AST));
+    AST *ast = ast_create(size);
     if (!ast) return NULL;
     
-    ast->capacity = 256;
-    ast->count = 0;
-    ast->tokens = malloc(ast->capacity * sizeof(Token));
-    if (!ast->tokens) {
-        free(ast);
-        return NULL;
-    }
-    
     const char *ptr = source;
     const char *end = source + size;
     int line = 1;
@@ -105,6 +292,7 @@ AST* lex(const char *source, size_t size) {
     LexerState state = STATE_CODE;
     char string_delimiter = 0;
     const char *token_start = ptr;
+    DepState deps = {0, DEP_IMPORT, 0};
     
     while (ptr < end) {
         char current = *ptr;
@@ -112,6 +300,13 @@ AST* lex(const char *source, size_t size) {
         
         switch (state) {
             case STATE_CODE:
+                // Module statements for dependency collection
+                if (current == 'i' || current == 'e') {
+                    dep_note_keyword(&deps, source, ptr, end);
+                } else if (current == ';') {
+                    deps.pending = 0;
+                }
+
                 // String literals
                 if ((current == '"' || current == '\'' || current == '`') && 
                     (ptr == source || *(ptr - 1) != '\\')) {
@@ -139,19 +334,19 @@ AST* lex(const char *source, size_t size) {
                 }
                 
                 // Keywords
-                if (strncmp(ptr, "interface", 9) == 0 && (ptr + 9 >= end || (!isalnum(*(ptr + 9)) && *(ptr + 9) != '_'))) {
+                if (end - ptr >= 9 && strncmp(ptr, "interface", 9) == 0 && (ptr + 9 >= end || (!isalnum(*(ptr + 9)) && *(ptr + 9) != '_'))) {
                     ast_add_token(ast, TOKEN_INTERFACE, ptr, 9, line);
                     ptr += 9;
                     continue;
                 }
                 
-                if (strncmp(ptr, "type ", 5) == 0) {
+                if (end - ptr >= 5 && strncmp(ptr, "type ", 5) == 0) {
                     ast_add_token(ast, TOKEN_TYPE, ptr, 4, line);
                     ptr += 4;
                     continue;
                 }
                 
-                if (strncmp(ptr, "implements ", 11) == 0) {
+                if (end - ptr >= 11 && strncmp(ptr, "implements ", 11) == 0) {
                     ast_add_token(ast, TOKEN_IMPLEMENTS, ptr, 10, line);
                     ptr += 10;
                     continue;
@@ -164,7 +359,7 @@ AST* lex(const char *source, size_t size) {
                     continue;
                 }
                 
-                if (strncmp(ptr, "private", 7) == 0 && (ptr + 7 >= end || (!isalnum(*(ptr + 7)) && *(ptr + 7) != '_'))) {
+                if (end - ptr >= 7 && strncmp(ptr, "private", 7) == 0 && (ptr + 7 >= end || (!isalnum(*(ptr + 7)) && *(ptr + 7) != '_'))) {
                     ast_add_token(ast, TOKEN_PRIVATE, ptr, 7, line);
                     ptr += 7;
                     continue;
@@ -217,6 +412,7 @@ AST* lex(const char *source, size_t size) {
                 if (current == string_delimiter && (ptr == source || *(ptr - 1) != '\\')) {
                     ptr++;
                     ast_add_token(ast, TOKEN_STRING, token_start, ptr - token_start, line);
+                    dep_note_string(ast, &deps, source, token_start, ptr, end, line);
                     state = STATE_CODE;
                 } else {
                     ptr++;
@@ -252,24 +448,599 @@ AST* lex(const char *source, size_t size) {
     }
     
     ast_add_token(ast, TOKEN_EOF, ptr, 0, line);
+    classify_colons(ast);
     return ast;
 }
 
 // ============================================================================
-// PARSER: Process AST and strip types
+// TYPES: Skip one type expression after an annotation colon
 // ============================================================================
 
-char* parse(const AST *ast, const char *source) {
-    if (!ast || !source) {
-        return NULL;
+// Words that take a type operand: keyof T, typeof x, readonly T[], new () => T
+static int is_type_prefix(const char *word, size_t len) {
+    return word_is(word, len, "keyof") || word_is(word, len, "typeof") ||
+           word_is(word, len, "readonly") || word_is(word, len, "infer") ||
+           word_is(word, len, "unique") || word_is(word, len, "new") ||
+           word_is(word, len, "abstract") || word_is(word, len, "asserts");
+}
+
+// Identifier bytes, including keyword tokens lexed inside a word
+static int is_word_token(const Token *t) {
+    switch (t->type) {
+        case TOKEN_CODE:
+            return is_ident_char(*t->start) || (unsigned char)*t->start >= 0x80;
+        case TOKEN_INTERFACE:
+        case TOKEN_TYPE:
+        case TOKEN_IMPLEMENTS:
+        case TOKEN_AS:
+        case TOKEN_PRIVATE:
+            return 1;
+        default:
+            return 0;
     }
-    
-    StringBuilder *output = sb_create(4096);
-    if (!output) {
-        return NULL;
+}
+
+static int is_blank_token(const Token *t) {
+    return t->type == TOKEN_BLOCK_COMMENT ||
+           (t->type == TOKEN_CODE && *t->start != '\n' && isspace((unsigned char)*t->start));
+}
+
+static int opens_group(const Token *t) {
+    return t->type == TOKEN_LT ||
+           (t->type == TOKEN_CODE && (*t->start == '(' || *t->start == '[' || *t->start == '{'));
+}
+
+// The '>' of "=>" closes nothing
+static int closes_group(const Token *tokens, size_t i) {
+    const Token *t = &tokens[i];
+    if (t->type == TOKEN_GT) return i == 0 || tokens[i - 1].type != TOKEN_EQ;
+    return t->type == TOKEN_CODE && (*t->start == ')' || *t->start == ']' || *t->start == '}');
+}
+
+// After a line break at depth 0, a leading | or & (or the ? and : of an open
+// conditional type) continues the type on the next line
+static int continues_type(const Token *tokens, size_t count, size_t i,
+                          size_t extends_open, size_t questions_open) {
+    while (i < count && (is_blank_token(&tokens[i]) || tokens[i].type == TOKEN_LINE_COMMENT ||
+                         (tokens[i].type == TOKEN_CODE && *tokens[i].start == '\n'))) {
+        i++;
     }
-    
-    for (size_t i = 0; i < ast->count; i++) {
+    if (i >= count) return 0;
+    if (tokens[i].type == TOKEN_COLON) return questions_open > 0;
+    if (tokens[i].type != TOKEN_CODE) return 0;
+
+    char c = *tokens[i].start;
+    return c == '|' || c == '&' || (c == '?' && extends_open > 0) || (c == ':' && questions_open > 0);
+}
+
+// The original rule: stop at a ',', ';', '{', '}', ')', newline or '=' outside <>
+static size_t skip_type_delimited(const AST *ast, size_t i) {
+    int depth = 0;
+    while (i < ast->count) {
+        Token t = ast->tokens[i];
+        if (t.type == TOKEN_LT) depth++;
+        else if (t.type == TOKEN_GT && depth > 0) depth--;
+
+        if (depth == 0 && t.type == TOKEN_CODE) {
+            char c = *t.start;
+            if (c == ',' || c == ';' || c == '{' || c == '}' || c == '\n' || c == ')') break;
+        }
+        if (depth == 0 && t.type == TOKEN_EQ) break;
+        i++;
+    }
+    return i;
+}
+
+// Consume one type expression starting at token i (just past the colon) in a
+// single pass: (), [], {} and <> nest, | & extends ? : => . and prefix words
+// join operands, and at depth 0 the type ends where the grammar cannot go on.
+// Returns the index just past its last token (trailing blanks are kept).
+// Unbalanced brackets fall back to the original delimiter rule.
+size_t skip_type(const AST *ast, size_t i) {
+    const Token *tokens = ast->tokens;
+    size_t count = ast->count;
+    size_t start = i;
+    size_t consumed = i;
+    size_t depth = 0;
+    size_t extends_open = 0;     // Conditional types waiting for their ?
+    size_t questions_open = 0;   // ... and for their :
+    int expect = 1;              // An operand must come next
+    int paren_group = 0;         // Last operand was a (...) group, so => may follow
+    int after_import = 0;        // Last operand was import, as in import("x")
+
+    while (i < count && tokens[i].type != TOKEN_EOF) {
+        const Token *t = &tokens[i];
+        char c = *t->start;
+
+        if (is_blank_token(t)) {
+            i++;
+            continue;
+        }
+
+        // Line breaks (a line comment swallows its newline) end the type
+        // unless it is incomplete or the next line continues it
+        if (t->type == TOKEN_LINE_COMMENT || (t->type == TOKEN_CODE && c == '\n')) {
+            if (depth == 0 && !expect &&
+                !continues_type(tokens, count, i + 1, extends_open, questions_open)) {
+                break;
+            }
+            i++;
+            continue;
+        }
+
+        if (depth > 0) {
+            if (opens_group(t)) {
+                depth++;
+            } else if (closes_group(tokens, i) && --depth == 0) {
+                expect = 0;
+                paren_group = c == ')';
+                after_import = 0;
+                consumed = i + 1;
+            }
+            i++;
+            continue;
+        }
+
+        if (is_word_token(t)) {
+            size_t j = i + 1;
+            while (j < count && is_word_token(&tokens[j])) j++;
+            const char *word = t->start;
+            size_t len = (size_t)(tokens[j - 1].start + tokens[j - 1].length - word);
+
+            if (expect) {
+                if (!is_type_prefix(word, len)) {
+                    expect = 0;
+                    paren_group = 0;
+                    after_import = word_is(word, len, "import");
+                }
+            } else if (word_is(word, len, "extends")) {
+                extends_open++;
+                expect = 1;
+            } else if (word_is(word, len, "is")) {
+                expect = 1;
+            } else {
+                break;
+            }
+            i = consumed = j;
+            continue;
+        }
+
+        if (t->type == TOKEN_STRING) {
+            if (!expect) break;
+            expect = 0;
+            paren_group = 0;
+            after_import = 0;
+            i = consumed = i + 1;
+            continue;
+        }
+
+        // Function type: (params) => result
+        if (t->type == TOKEN_EQ) {
+            int arrow = i + 1 < count && tokens[i + 1].type == TOKEN_GT;
+            if (!arrow || expect || !paren_group) break;
+            expect = 1;
+            i = consumed = i + 2;
+            continue;
+        }
+
+        if (t->type == TOKEN_COLON || (t->type == TOKEN_CODE && c == ':')) {
+            if (questions_open == 0) break;
+            questions_open--;
+            expect = 1;
+            i = consumed = i + 1;
+            continue;
+        }
+
+        // Groups: parenthesized and function types, tuples and T[], object
+        // types, generic arguments written right after their operand
+        int opens = 0;
+        if (t->type == TOKEN_LT) {
+            opens = expect || (i > 0 && !is_blank_token(&tokens[i - 1]));
+        } else if (t->type == TOKEN_CODE) {
+            opens = c == '[' || ((c == '(' || c == '{') && expect) || (c == '(' && after_import);
+        }
+        if (opens) {
+            depth = 1;
+            i++;
+            continue;
+        }
+        if (t->type != TOKEN_CODE) break;
+
+        if (c == '|' || c == '&') {
+            expect = 1;
+        } else if (c == '?' && !expect && extends_open > 0) {
+            extends_open--;
+            questions_open++;
+            expect = 1;
+        } else if (c == '.' && !expect) {
+            expect = 1;              // Qualified name
+        } else if (c == '-' && expect) {
+            // Negative literal
+        } else {
+            break;
+        }
+        i = consumed = i + 1;
+    }
+
+    if (depth > 0) {
+        return skip_type_delimited(ast, start);
+    }
+    return consumed;
+}
+
+// ============================================================================
+// COLONS: Tell annotation colons from ternaries, properties and labels
+// ============================================================================
+
+// What the innermost open bracket holds
+typedef enum {
+    FRAME_BLOCK,             // Statements: top level, function and control bodies
+    FRAME_CLASS,             // Class members
+    FRAME_TYPE,              // Interface and object type members
+    FRAME_OBJECT,            // Object literal or destructuring pattern
+    FRAME_PAREN,             // Parameters, arguments, conditions
+    FRAME_BRACKET            // Array literals, index signatures
+} FrameKind;
+
+typedef enum {
+    DECL_NONE,
+    DECL_BINDING,            // After let/const/var: names and their annotations
+    DECL_INIT                // After '=' (class members too)
+} DeclState;
+
+typedef struct {
+    FrameKind kind;
+    DeclState decl;
+    FrameKind header;        // Body kind the next '{' opens after class/interface
+    int has_header;
+    size_t angles;           // <> depth inside that header
+    size_t ternaries;        // '?' waiting for its ':'
+    int case_open;           // case label waiting for its ':'
+    int type_alias;          // type X = ...: braces hold object types
+} ColonFrame;
+
+typedef enum {
+    WORD_OTHER,
+    WORD_DECL,               // let const var
+    WORD_CLASS,
+    WORD_CASE,
+    WORD_AS,
+    WORD_OPERATOR            // Keywords followed by an expression
+} WordKind;
+
+typedef enum {
+    PREV_START,
+    PREV_PUNCT,
+    PREV_WORD,
+    PREV_STRING,
+    PREV_ARROW,
+    PREV_ANNOTATION,         // Annotation colon
+    PREV_LABEL,              // case/default/label colon
+    PREV_VALUE_COLON         // Ternary or property colon
+} PrevKind;
+
+// What one token means to the colon pass; code bytes go through colon_byte
+typedef enum {
+    COLON_PUNCT = 0,         // Default for code bytes: checked for a word
+    COLON_BLANK,
+    COLON_NEWLINE,
+    COLON_OPEN,
+    COLON_CLOSE,
+    COLON_QUESTION,
+    COLON_COMMA,
+    COLON_SEMI,
+    COLON_COLON,
+    COLON_WORD,
+    COLON_STRING,
+    COLON_LT,
+    COLON_GT,
+    COLON_EQ,
+    COLON_SKIP,
+    COLON_END
+} ColonClass;
+
+static const unsigned char colon_byte[256] = {
+    [' '] = COLON_BLANK, ['\t'] = COLON_BLANK, ['\r'] = COLON_BLANK, ['\n'] = COLON_NEWLINE,
+    ['{'] = COLON_OPEN, ['('] = COLON_OPEN, ['['] = COLON_OPEN,
+    ['}'] = COLON_CLOSE, [')'] = COLON_CLOSE, [']'] = COLON_CLOSE,
+    ['?'] = COLON_QUESTION, [','] = COLON_COMMA, [';'] = COLON_SEMI, [':'] = COLON_COLON,
+};
+
+// is_word_token() for code bytes, without the ctype calls
+static inline int colon_word_byte(unsigned char c) {
+    return (unsigned)((c | 0x20) - 'a') < 26 || (unsigned)(c - '0') < 10
+           || c == '_' || c == '$' || c >= 0x80;
+}
+
+static inline ColonClass colon_class(const Token *t) {
+    switch (t->type) {
+        case TOKEN_CODE: {
+            unsigned char c = (unsigned char)*t->start;
+            ColonClass cls = (ColonClass)colon_byte[c];
+            return cls == COLON_PUNCT && colon_word_byte(c) ? COLON_WORD : cls;
+        }
+        case TOKEN_COLON:
+        case TOKEN_OPTIONAL:
+            return COLON_COLON;
+        case TOKEN_STRING:
+            return COLON_STRING;
+        case TOKEN_LT:
+            return COLON_LT;
+        case TOKEN_GT:
+            return COLON_GT;
+        case TOKEN_EQ:
+            return COLON_EQ;
+        case TOKEN_BLOCK_COMMENT:
+        case TOKEN_LINE_COMMENT:
+            return COLON_SKIP;
+        case TOKEN_EOF:
+            return COLON_END;
+        default:
+            return COLON_WORD;
+    }
+}
+
+typedef struct {
+    const char *word;
+    size_t length;
+    WordKind kind;
+} ColonKeyword;
+
+static const ColonKeyword colon_keywords[] = {
+    {"let", 3, WORD_DECL}, {"const", 5, WORD_DECL}, {"var", 3, WORD_DECL},
+    {"class", 5, WORD_CLASS}, {"case", 4, WORD_CASE}, {"as", 2, WORD_AS},
+    {"return", 6, WORD_OPERATOR}, {"typeof", 6, WORD_OPERATOR}, {"in", 2, WORD_OPERATOR},
+    {"of", 2, WORD_OPERATOR}, {"yield", 5, WORD_OPERATOR}, {"await", 5, WORD_OPERATOR},
+    {"void", 4, WORD_OPERATOR}, {"delete", 6, WORD_OPERATOR}, {"throw", 5, WORD_OPERATOR},
+    {"new", 3, WORD_OPERATOR}, {"instanceof", 10, WORD_OPERATOR}, {"default", 7, WORD_OPERATOR},
+};
+
+static WordKind word_kind(const char *word, size_t len) {
+    // Length and first byte rule out nearly every identifier before memcmp
+    for (size_t k = 0; k < sizeof(colon_keywords) / sizeof(colon_keywords[0]); k++) {
+        const ColonKeyword *kw = &colon_keywords[k];
+        if (kw->length == len && kw->word[0] == word[0] && memcmp(word, kw->word, len) == 0) {
+            return kw->kind;
+        }
+    }
+    return WORD_OTHER;
+}
+
+// What a '{' opens, judged by the token before it
+static FrameKind brace_kind(ColonFrame *f, PrevKind prev, char prev_char, WordKind prev_word) {
+    if (f->has_header && f->angles == 0) {
+        f->has_header = 0;
+        return f->header;
+    }
+    if (f->type_alias || prev == PREV_ANNOTATION) return FRAME_TYPE;
+
+    switch (prev) {
+        case PREV_START:
+        case PREV_ARROW:
+        case PREV_LABEL:
+        case PREV_STRING:
+            return FRAME_BLOCK;
+        case PREV_WORD:
+            return prev_word == WORD_OTHER || prev_word == WORD_CLASS ? FRAME_BLOCK : FRAME_OBJECT;
+        case PREV_PUNCT:
+            return prev_char == ')' || prev_char == ';' || prev_char == '{' || prev_char == '}'
+                   ? FRAME_BLOCK : FRAME_OBJECT;
+        default:
+            return FRAME_OBJECT;
+    }
+}
+
+// Whether the colon closing frame's current construct introduces a type
+static int colon_is_annotation(ColonFrame *f, char prev_char, PrevKind *kind) {
+    if (f->ternaries > 0) {
+        f->ternaries--;
+        *kind = PREV_VALUE_COLON;
+        return 0;
+    }
+    if (f->case_open) {
+        f->case_open = 0;
+        *kind = PREV_LABEL;
+        return 0;
+    }
+
+    int annotation;
+    switch (f->kind) {
+        case FRAME_OBJECT:
+            // Only a method's return type follows ')'; otherwise key: value
+            annotation = prev_char == ')';
+            *kind = annotation ? PREV_ANNOTATION : PREV_VALUE_COLON;
+            return annotation;
+        case FRAME_BLOCK:
+            annotation = prev_char == ')' || f->decl == DECL_BINDING;
+            *kind = annotation ? PREV_ANNOTATION : PREV_LABEL;
+            return annotation;
+        default:
+            *kind = PREV_ANNOTATION;
+            return 1;
+    }
+}
+
+// Retype colons by syntactic context in one pass over the tokens: only
+// annotation colons stay (or become) TOKEN_COLON; ternary, property, case and
+// label colons become TOKEN_CODE. Called by every lexer once tokens are in.
+void classify_colons(AST *ast) {
+    Token *tokens = ast->tokens;
+    size_t count = ast->count;
+
+    size_t capacity = 32;
+    size_t depth = 1;
+    ColonFrame *frames = malloc(capacity * sizeof(ColonFrame));
+    if (!frames) return;
+    memset(&frames[0], 0, sizeof(ColonFrame));
+    frames[0].kind = FRAME_BLOCK;
+
+    PrevKind prev = PREV_START;
+    char prev_char = 0;
+    WordKind prev_word = WORD_OTHER;
+    const char *end = tokens[count - 1].start;
+
+    for (size_t i = 0; i < count; i++) {
+        Token *t = &tokens[i];
+        ColonFrame *f = &frames[depth - 1];
+        ColonClass cls = colon_class(t);
+        char c = *t->start;
+        PrevKind next_prev = PREV_PUNCT;
+
+        switch (cls) {
+            case COLON_END:
+                i = count;
+                continue;
+
+            case COLON_SKIP:
+            case COLON_BLANK:
+                continue;
+
+            case COLON_NEWLINE:
+                // A type alias or class member initializer ends with its line
+                f->type_alias = 0;
+                if (f->kind == FRAME_CLASS && f->ternaries == 0) f->decl = DECL_NONE;
+                continue;
+
+            case COLON_WORD: {
+                // Words are contiguous in the source: scan bytes, then catch up
+                const char *word = t->start;
+                const char *word_end = word + t->length;
+                while (word_end < end && colon_word_byte((unsigned char)*word_end)) word_end++;
+                size_t len = (size_t)(word_end - word);
+                size_t j = i + len;
+                if (j >= count || tokens[j].start != word_end) {
+                    // A keyword token inside the word: fewer tokens than bytes
+                    j = i + 1;
+                    while (tokens[j].start < word_end) j++;
+                }
+                WordKind kind = word_kind(word, len);
+                int member = prev == PREV_PUNCT && prev_char == '.';
+
+                if (!member && (f->kind == FRAME_BLOCK || f->kind == FRAME_PAREN)) {
+                    if (kind == WORD_DECL && prev_word != WORD_AS) f->decl = DECL_BINDING;
+                    if (kind == WORD_CASE && f->kind == FRAME_BLOCK) f->case_open = 1;
+                }
+                if (!member && f->kind != FRAME_OBJECT) {
+                    if (kind == WORD_CLASS || t->type == TOKEN_INTERFACE) {
+                        f->has_header = 1;
+                        f->header = kind == WORD_CLASS ? FRAME_CLASS : FRAME_TYPE;
+                        f->angles = 0;
+                    } else if (t->type == TOKEN_TYPE && j == i + 1 && f->kind == FRAME_BLOCK) {
+                        f->type_alias = 1;
+                    }
+                }
+
+                prev = PREV_WORD;
+                prev_word = kind;
+                i = j - 1;
+                continue;
+            }
+
+            case COLON_STRING:
+                prev = PREV_STRING;
+                prev_word = WORD_OTHER;
+                continue;
+
+            case COLON_COLON: {
+                PrevKind kind = PREV_ANNOTATION;
+                if (t->type == TOKEN_OPTIONAL) {
+                    // name?: T is always an annotation
+                } else if (colon_is_annotation(f, prev_char, &kind)) {
+                    if (t->type == TOKEN_CODE && !(prev == PREV_PUNCT && prev_char == '!')) {
+                        t->type = TOKEN_COLON;
+                    }
+                } else {
+                    t->type = TOKEN_CODE;
+                }
+                next_prev = kind;
+                break;
+            }
+
+            case COLON_LT:
+                if (f->has_header) f->angles++;
+                break;
+
+            case COLON_GT:
+                if (i > 0 && tokens[i - 1].type == TOKEN_EQ) {
+                    next_prev = PREV_ARROW;
+                } else if (f->has_header && f->angles > 0) {
+                    f->angles--;
+                }
+                break;
+
+            case COLON_EQ:
+                if ((f->decl == DECL_BINDING || f->kind == FRAME_CLASS)
+                    && !(i + 1 < count && tokens[i + 1].type == TOKEN_GT)) {
+                    f->decl = DECL_INIT;
+                }
+                break;
+
+            case COLON_OPEN: {
+                if (depth == capacity) {
+                    ColonFrame *grown = realloc(frames, capacity * 2 * sizeof(ColonFrame));
+                    if (!grown) {
+                        free(frames);
+                        return;
+                    }
+                    frames = grown;
+                    capacity *= 2;
+                    f = &frames[depth - 1];
+                }
+                FrameKind kind = c == '(' ? FRAME_PAREN : c == '[' ? FRAME_BRACKET
+                               : brace_kind(f, prev, prev_char, prev_word);
+                ColonFrame *inner = &frames[depth++];
+                memset(inner, 0, sizeof(*inner));
+                inner->kind = kind;
+                break;
+            }
+
+            case COLON_CLOSE:
+                if (depth > 1) depth--;
+                break;
+
+            case COLON_QUESTION: {
+                // Not ?. (optional chaining) or ?? (nullish coalescing)
+                char next = i + 1 < count && tokens[i + 1].type == TOKEN_CODE ? *tokens[i + 1].start : 0;
+                char after = i + 2 < count && tokens[i + 2].type == TOKEN_CODE ? *tokens[i + 2].start : 0;
+                int chaining = next == '.' && !isdigit((unsigned char)after);
+                int nullish = next == '?' || (prev == PREV_PUNCT && prev_char == '?');
+                int counted = f->kind != FRAME_CLASS || f->decl == DECL_INIT;
+                if (!chaining && !nullish && counted) f->ternaries++;
+                break;
+            }
+
+            case COLON_COMMA:
+                f->ternaries = 0;
+                if (f->decl == DECL_INIT && f->kind != FRAME_CLASS) f->decl = DECL_BINDING;
+                break;
+
+            case COLON_SEMI:
+                f->ternaries = 0;
+                f->decl = DECL_NONE;
+                f->case_open = 0;
+                f->type_alias = 0;
+                f->has_header = 0;
+                break;
+
+            case COLON_PUNCT:
+                break;
+        }
+
+        prev = next_prev;
+        prev_char = c;
+        prev_word = WORD_OTHER;
+    }
+
+    free(frames);
+}
+
+// ============================================================================
+// PARSER: Process AST and strip types
+// ============================================================================
+
+// The stripping rules, appending to output
+static void parse_tokens(const AST *ast, StringBuilder *output) {
+    for (size_t i = 0; i < ast->count && !output->stopped; i++) {
         Token token = ast->tokens[i];
         
         switch (token.type) {
@@ -427,35 +1198,8 @@ char* parse(const AST *ast, const char *source) {
                 break;
                 
             case TOKEN_COLON:
-                // Skip type annotation after colon
-                i++;
-                int depth = 0;
-                while (i < ast->count) {
-                    Token t = ast->tokens[i];
-                    
-                    // Track nesting depth for complex types
-                    if (t.type == TOKEN_LT) depth++;
-                    else if (t.type == TOKEN_GT) {
-                        if (depth > 0) depth--;
-                    }
-                    
-                    // Stop at delimiter when not nested
-                    if (depth == 0 && t.type == TOKEN_CODE) {
-                        char c = *t.start;
-                        if (c == ',' || c == ';' || c == '{' || c == '}' || c == '\n' || c == ')') {
-                            i--;
-                            break;
-                        }
-                    }
-                    
-                    // Also stop at = when not nested (for variable declarations)
-                    if (depth == 0 && t.type == TOKEN_EQ) {
-                        i--;
-                        break;
-                    }
-                    
-                    i++;
-                }
+                // Skip the type annotation after the colon
+                i = skip_type(ast, i + 1) - 1;
                 break;
                 
             case TOKEN_IMPLEMENTS:  {
@@ -488,8 +1232,8 @@ char* parse(const AST *ast, const char *source) {
                 break;
                 
             case TOKEN_OPTIONAL:
-                // Skip ?: but keep :
-                sb_append(output, ":");
+                // Skip ?: and the optional member's or parameter's type
+                i = skip_type(ast, i + 1) - 1;
                 break;
                 
             case TOKEN_PRIVATE:
@@ -501,10 +1245,53 @@ char* parse(const AST *ast, const char *source) {
         }
     }
 }
+}
+
+char* parse(const AST *ast, const char *source) {
+    if (!ast || !source) {
+        return NULL;
+    }
+    
+    // Stripping only removes text, so the output fits in the input size
+    size_t source_size = (size_t)(ast->tokens[ast->count - 1].start - source);
+    StringBuilder *output = sb_create(source_size + 1);
+    if (!output) {
+        return NULL;
+    }
+    large_advise(output->buffer, output->capacity, 1);
     
+    parse_tokens(ast, output);
     return sb_to_string(output);
 }
 
+size_t parse_into(const AST *ast, const char *source, char *buffer) {
+    size_t source_size = (size_t)(ast->tokens[ast->count - 1].start - source);
+    StringBuilder output = { buffer, 0, source_size + 1, 1, NULL, NULL, 0 };
+    buffer[0] = '\0';
+
+    parse_tokens(ast, &output);
+    return output.stopped ? SIZE_MAX : output.size;
+}
+
+int parse_sink(const AST *ast, const char *source, OutputSink sink, void *context) {
+    if (!ast || !source || !sink) {
+        return -1;
+    }
+
+    StringBuilder *output = sb_create(PARSE_SINK_CHUNK);
+    if (!output) {
+        return -1;
+    }
+    output->sink = sink;
+    output->context = context;
+
+    parse_tokens(ast, output);
+    sb_flush(output);
+    int status = output->stopped ? -1 : 0;
+    free(sb_to_string(output));
+    return status;
+}
+
 // ============================================================================
 // High-level API
 // ============================================================================
@@ -520,9 +1307,45 @@ char* strip_types(const char *source, size_t size) {
     return result;
 }
 
+char* strip_types_deps(const char *source, size_t size, ModuleDep **deps, size_t *dep_count) {
+    *deps = NULL;
+    *dep_count = 0;
+
+    AST *ast = lex(source, size);
+    if (!ast) {
+        return NULL;
+    }
+
+    char *result = parse(ast, source);
+    if (result) {
+        // Hand the dependency array over to the caller
+        *deps = ast->deps;
+        *dep_count = ast->dep_count;
+        ast->deps = NULL;
+    }
+    ast_free(ast);
+    return result;
+}
+
+int strip_types_sink(const char *source, size_t size, OutputSink sink, void *context) {
+    if (size == 0) {
+        return 0;  // Nothing to write
+    }
+
+    AST *ast = lex(source, size);
+    if (!ast) {
+        return -1;
+    }
+
+    int status = parse_sink(ast, source, sink, context);
+    ast_free(ast);
+    return status;
+}
+
 void ast_free(AST *ast) {
     if (ast) {
-        free(ast->tokens);
+        free(ast->deps);
+        large_free(ast->tokens);
         free(ast);
     }
 }
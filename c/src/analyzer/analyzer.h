@@ -30,11 +30,33 @@ typedef struct {
     int line;                // Line number
 } Token;
 
+// Module dependency kinds collected while lexing
+typedef enum {
+    DEP_IMPORT,              // import ... from "x" / import "x"
+    DEP_EXPORT_FROM,         // export ... from "x"
+    DEP_REQUIRE,             // require("x")
+    DEP_DYNAMIC_IMPORT       // import("x")
+} DepKind;
+
+// Module specifier referenced by the source
+typedef struct {
+    DepKind kind;
+    int type_only;           // import type / export type statement
+    const char *specifier;   // Pointer to specifier in source (without quotes)
+    size_t length;           // Length of specifier
+    size_t start;            // Byte offset of the string literal (opening quote)
+    size_t end;              // Byte offset just past the closing quote
+    int line;                // Line number
+} ModuleDep;
+
 // AST Node list (array of tokens)
 typedef struct {
     Token *tokens;
     size_t count;
     size_t capacity;
+    ModuleDep *deps;         // Module specifiers found during lexing
+    size_t dep_count;
+    size_t dep_capacity;
 } AST;
 
 // Lexer: Tokenize source code into AST
@@ -43,6 +65,17 @@ AST* lex(const char *source, size_t size);
 // Parser: Process AST and strip types
 char* parse(const AST *ast, const char *source);
 
+// Receives stripped output in order, in chunks that are valid only during
+// the call; return nonzero to stop
+typedef int (*OutputSink)(void *context, const char *data, size_t length);
+
+// Bytes parse_sink() gathers before each call to the sink
+#define PARSE_SINK_CHUNK (64 * 1024)
+
+// parse() that pushes the output to sink in chunks instead of joining it
+// into one string; returns 0, or -1 when the sink stopped it
+int parse_sink(const AST *ast, const char *source, OutputSink sink, void *context);
+
 // Free AST memory
 void ast_free(AST *ast);
 
@@ -50,4 +83,16 @@ void ast_free(AST *ast);
 // The caller is responsible for freeing the returned string
 char* strip_types(const char *source, size_t size);
 
+// Strip types and collect module specifiers from the same lex pass
+// On success *deps receives a malloc'd array (free with free()) whose
+// specifier pointers point into source
+char* strip_types_deps(const char *source, size_t size, ModuleDep **deps, size_t *dep_count);
+
+// Streaming strip_types(): the output goes to sink, no buffer is built
+// Returns 0, or -1 when lexing failed or the sink stopped
+int strip_types_sink(const char *source, size_t size, OutputSink sink, void *context);
+
+// Name of a dependency kind as used in JSON output
+const char* dep_kind_name(DepKind kind);
+
 #endif // ANALYZER_H
@@ -0,0 +1,238 @@
+#define _DEFAULT_SOURCE
+
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#ifdef __linux__
+#include <sys/mman.h>
+#define LARGE_ALLOC_MMAP 1
+#endif
+
+#define ARENA_ALIGN sizeof(max_align_t)
+
+static size_t align_up(size_t size) {
+    return (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+void arena_init(Arena *arena, size_t chunk_size) {
+    arena->head = NULL;
+    arena->chunk_size = chunk_size;
+}
+
+static ArenaChunk* arena_new_chunk(Arena *arena, size_t size) {
+    size_t capacity = size > arena->chunk_size ? size : arena->chunk_size;
+    ArenaChunk *chunk = large_alloc(sizeof(ArenaChunk) + capacity, 0);
+    if (!chunk) return NULL;
+
+    chunk->next = arena->head;
+    chunk->used = 0;
+    chunk->capacity = capacity;
+    chunk->last = NULL;
+    arena->head = chunk;
+    return chunk;
+}
+
+void* arena_alloc(Arena *arena, size_t size) {
+    size = align_up(size ? size : 1);
+
+    ArenaChunk *chunk = arena->head;
+    if (!chunk || chunk->capacity - chunk->used < size) {
+        chunk = arena_new_chunk(arena, size);
+        if (!chunk) return NULL;
+    }
+
+    void *ptr = (char*)chunk->data + chunk->used;
+    chunk->used += size;
+    chunk->last = ptr;
+    return ptr;
+}
+
+void* arena_grow(Arena *arena, void *ptr, size_t old_size, size_t new_size) {
+    if (!ptr) return arena_alloc(arena, new_size);
+
+    // The newest allocation can simply take more of its chunk
+    ArenaChunk *chunk = arena->head;
+    if (chunk && chunk->last == ptr) {
+        size_t offset = (size_t)((char*)ptr - (char*)chunk->data);
+        if (align_up(new_size) <= chunk->capacity - offset) {
+            chunk->used = offset + align_up(new_size);
+            return ptr;
+        }
+    }
+
+    void *moved = arena_alloc(arena, new_size);
+    if (!moved) return NULL;
+    memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    return moved;
+}
+
+void arena_free(Arena *arena) {
+    ArenaChunk *chunk = arena->head;
+    while (chunk) {
+        ArenaChunk *next = chunk->next;
+        large_free(chunk);
+        chunk = next;
+    }
+    arena->head = NULL;
+}
+
+// ============================================================================
+// Large allocations
+// ============================================================================
+
+#define HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+#define SMALL_PAGE_SIZE ((size_t)4096)
+#define ALWAYS_THRESHOLD ((size_t)64 * 1024)
+
+// Precedes every large block so large_free knows how it was obtained
+typedef union {
+    struct {
+        size_t size;         // Usable bytes
+        void *base;          // Mapping or malloc pointer
+        size_t mapped_size;  // Mapping length (0 for malloc)
+    } info;
+    max_align_t align;
+    char pad[64];
+} LargeHeader;
+
+static HugePageMode huge_mode = HUGEPAGES_AUTO;
+static int prefault_enabled = 1;
+
+static atomic_size_t stat_allocations;
+static atomic_size_t stat_mappings;
+static atomic_size_t stat_mapped_bytes;
+static atomic_size_t stat_huge_bytes;
+static atomic_size_t stat_prefaulted_bytes;
+
+void large_alloc_configure(HugePageMode mode, int prefault) {
+    huge_mode = mode;
+    prefault_enabled = prefault;
+}
+
+static size_t huge_threshold(void) {
+    return huge_mode == HUGEPAGES_ALWAYS ? ALWAYS_THRESHOLD : HUGE_PAGE_SIZE;
+}
+
+#ifdef LARGE_ALLOC_MMAP
+// Fault pages in now, after the huge page advice, so they arrive as huge pages
+static void prefault(char *start, size_t length) {
+#ifdef MADV_POPULATE_WRITE
+    if (madvise(start, length, MADV_POPULATE_WRITE) == 0) {
+        atomic_fetch_add(&stat_prefaulted_bytes, length);
+        return;
+    }
+#endif
+    for (size_t offset = 0; offset < length; offset += SMALL_PAGE_SIZE) {
+        ((volatile char*)start)[offset] = 0;
+    }
+    atomic_fetch_add(&stat_prefaulted_bytes, length);
+}
+
+// 2 MB-aligned anonymous mapping advised for transparent huge pages
+static void* map_aligned(size_t length) {
+    char *raw = mmap(NULL, length + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+
+    char *base = (char*)(((uintptr_t)raw + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+    size_t head = (size_t)(base - raw);
+    if (head) munmap(raw, head);
+    if (HUGE_PAGE_SIZE - head) munmap(base + length, HUGE_PAGE_SIZE - head);
+
+#ifdef MADV_HUGEPAGE
+    if (madvise(base, length, MADV_HUGEPAGE) == 0) {
+        atomic_fetch_add(&stat_huge_bytes, length);
+    }
+#endif
+    atomic_fetch_add(&stat_mappings, 1);
+    atomic_fetch_add(&stat_mapped_bytes, length);
+    return base;
+}
+#endif
+
+void* large_alloc(size_t size, int populate) {
+    atomic_fetch_add(&stat_allocations, 1);
+
+#ifdef LARGE_ALLOC_MMAP
+    if (huge_mode != HUGEPAGES_OFF && size >= huge_threshold()) {
+        size_t length = (size + sizeof(LargeHeader) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        char *base = map_aligned(length);
+        if (base) {
+            if (populate && prefault_enabled) prefault(base, length);
+            LargeHeader *header = (LargeHeader*)base;
+            header->info.size = size;
+            header->info.base = base;
+            header->info.mapped_size = length;
+            return base + sizeof(LargeHeader);
+        }
+    }
+#else
+    (void)populate;
+#endif
+
+    char *raw = malloc(size + sizeof(LargeHeader));
+    if (!raw) return NULL;
+    LargeHeader *header = (LargeHeader*)raw;
+    header->info.size = size;
+    header->info.base = raw;
+    header->info.mapped_size = 0;
+    return raw + sizeof(LargeHeader);
+}
+
+void* large_grow(void *ptr, size_t new_size) {
+    if (!ptr) return large_alloc(new_size, 0);
+
+    LargeHeader *header = (LargeHeader*)((char*)ptr - sizeof(LargeHeader));
+    if (new_size <= header->info.size) return ptr;
+
+    void *grown = large_alloc(new_size, 0);
+    if (!grown) return NULL;
+    memcpy(grown, ptr, header->info.size);
+    large_free(ptr);
+    return grown;
+}
+
+void large_free(void *ptr) {
+    if (!ptr) return;
+
+    LargeHeader *header = (LargeHeader*)((char*)ptr - sizeof(LargeHeader));
+#ifdef LARGE_ALLOC_MMAP
+    if (header->info.mapped_size) {
+        munmap(header->info.base, header->info.mapped_size);
+        return;
+    }
+#endif
+    free(header->info.base);
+}
+
+void large_advise(void *ptr, size_t size, int populate) {
+#ifdef LARGE_ALLOC_MMAP
+    if (huge_mode == HUGEPAGES_OFF || size < huge_threshold()) return;
+
+    // madvise needs page-aligned bounds; only whole pages inside the buffer qualify
+    uintptr_t start = ((uintptr_t)ptr + SMALL_PAGE_SIZE - 1) & ~(uintptr_t)(SMALL_PAGE_SIZE - 1);
+    uintptr_t end = ((uintptr_t)ptr + size) & ~(uintptr_t)(SMALL_PAGE_SIZE - 1);
+    if (end <= start) return;
+
+#ifdef MADV_HUGEPAGE
+    if (madvise((void*)start, end - start, MADV_HUGEPAGE) == 0) {
+        atomic_fetch_add(&stat_huge_bytes, end - start);
+    }
+#endif
+    if (populate && prefault_enabled) prefault((char*)start, end - start);
+#else
+    (void)ptr;
+    (void)size;
+    (void)populate;
+#endif
+}
+
+void large_alloc_stats(LargeAllocStats *stats) {
+    stats->allocations = atomic_load(&stat_allocations);
+    stats->mappings = atomic_load(&stat_mappings);
+    stats->mapped_bytes = atomic_load(&stat_mapped_bytes);
+    stats->huge_bytes = atomic_load(&stat_huge_bytes);
+    stats->prefaulted_bytes = atomic_load(&stat_prefaulted_bytes);
+}
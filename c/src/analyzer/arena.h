@@ -0,0 +1,72 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// Chunk of arena memory; allocations are bumped from data
+typedef struct ArenaChunk {
+    struct ArenaChunk *next;
+    size_t used;
+    size_t capacity;
+    void *last;              // Most recent allocation (can grow in place)
+    max_align_t data[];
+} ArenaChunk;
+
+// Bump allocator: everything is released at once by arena_free()
+typedef struct {
+    ArenaChunk *head;
+    size_t chunk_size;       // Minimum size of new chunks
+} Arena;
+
+// Initialize an empty arena
+void arena_init(Arena *arena, size_t chunk_size);
+
+// Allocate size bytes aligned for any type
+void* arena_alloc(Arena *arena, size_t size);
+
+// Resize an allocation, extending it in place when it is the newest one
+void* arena_grow(Arena *arena, void *ptr, size_t old_size, size_t new_size);
+
+// Release every chunk
+void arena_free(Arena *arena);
+
+// ============================================================================
+// Large allocations (token arrays, output buffers, big arena chunks)
+// ============================================================================
+
+// Policy for large allocations
+typedef enum {
+    HUGEPAGES_OFF,           // Plain malloc
+    HUGEPAGES_AUTO,          // 2 MB-aligned mappings with MADV_HUGEPAGE from 2 MB up
+    HUGEPAGES_ALWAYS         // Aligned mappings with MADV_HUGEPAGE from 64 KB up
+} HugePageMode;
+
+// Counters since process start
+typedef struct {
+    size_t allocations;      // Large allocations requested
+    size_t mappings;         // Of which served by aligned mappings
+    size_t mapped_bytes;     // Bytes mapped
+    size_t huge_bytes;       // Bytes advised MADV_HUGEPAGE
+    size_t prefaulted_bytes; // Bytes populated before first use
+} LargeAllocStats;
+
+// Set the policy; call before any worker threads start
+void large_alloc_configure(HugePageMode mode, int prefault);
+
+// Allocate size bytes; populate when the caller will write all of it soon
+void* large_alloc(size_t size, int populate);
+
+// Resize a large allocation (contents up to the old size are kept)
+void* large_grow(void *ptr, size_t new_size);
+
+// Free a block returned by large_alloc or large_grow
+void large_free(void *ptr);
+
+// Apply the policy to a malloc'd buffer in place (huge page advice on its
+// aligned interior and prefaulting), for buffers handed back to callers
+void large_advise(void *ptr, size_t size, int populate);
+
+// Snapshot of the counters
+void large_alloc_stats(LargeAllocStats *stats);
+
+#endif // ARENA_H
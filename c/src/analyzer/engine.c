@@ -0,0 +1,223 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "engine.h"
+#include "lexer.h"
+#include "../hash/hash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+static Engine selected_engine = ENGINE_REFERENCE;
+static double shadow_rate = 0.0;
+static atomic_ulong request_counter;
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static EngineStats stats;
+
+int engine_from_name(const char *name, Engine *engine) {
+    if (strcmp(name, "reference") == 0) {
+        *engine = ENGINE_REFERENCE;
+    } else if (strcmp(name, "fast") == 0) {
+        *engine = ENGINE_FAST;
+    } else if (strcmp(name, "structural") == 0) {
+        *engine = ENGINE_STRUCTURAL;
+    } else if (strcmp(name, "threaded") == 0) {
+        *engine = ENGINE_THREADED;
+    } else if (strcmp(name, "auto") == 0) {
+        *engine = ENGINE_AUTO;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+const char* engine_name(Engine engine) {
+    switch (engine) {
+        case ENGINE_REFERENCE:  return "reference";
+        case ENGINE_FAST:       return "fast";
+        case ENGINE_STRUCTURAL: return "structural";
+        case ENGINE_THREADED:   return "threaded";
+        case ENGINE_AUTO:       return "auto";
+    }
+    return "unknown";
+}
+
+// The structural lexer only beats the fast one with a vector index pass
+Engine engine_resolve(Engine engine) {
+    if (engine != ENGINE_AUTO) return engine;
+    return lex_structural_vectorized() ? ENGINE_STRUCTURAL : ENGINE_FAST;
+}
+
+void engine_configure(Engine engine, double rate) {
+    selected_engine = engine_resolve(engine);
+    shadow_rate = rate < 0 ? 0 : rate > 1 ? 1 : rate;
+}
+
+Engine engine_selected(void) {
+    return selected_engine;
+}
+
+AST* engine_lex(Engine engine, const char *source, size_t size) {
+    switch (engine_resolve(engine)) {
+        case ENGINE_FAST:       return lex_fast(source, size);
+        case ENGINE_STRUCTURAL: return lex_structural(source, size);
+        case ENGINE_THREADED:   return lex_threaded(source, size);
+        default:                return lex(source, size);
+    }
+}
+
+char* engine_parse(Engine engine, const AST *ast, const char *source) {
+    switch (engine_resolve(engine)) {
+        case ENGINE_FAST:
+        case ENGINE_STRUCTURAL:
+        case ENGINE_THREADED:   return parse_fast(ast, source);
+        default:                return parse(ast, source);
+    }
+}
+
+size_t engine_parse_into(Engine engine, const AST *ast, const char *source, char *buffer) {
+    switch (engine_resolve(engine)) {
+        case ENGINE_FAST:
+        case ENGINE_STRUCTURAL:
+        case ENGINE_THREADED:   return parse_fast_into(ast, source, buffer);
+        default:                return parse_into(ast, source, buffer);
+    }
+}
+
+char* strip_types_engine(Engine engine, const char *source, size_t size) {
+    AST *ast = engine_lex(engine, source, size);
+    if (!ast) {
+        return NULL;
+    }
+
+    char *result = engine_parse(engine, ast, source);
+    ast_free(ast);
+    return result;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// Spread rate * N samples evenly over the first N requests
+static int take_sample(void) {
+    if (shadow_rate <= 0) return 0;
+    unsigned long n = atomic_fetch_add(&request_counter, 1);
+    return (unsigned long)((n + 1) * shadow_rate) != (unsigned long)(n * shadow_rate);
+}
+
+static void report_mismatch(Engine primary, Engine shadow, const char *source, size_t size,
+                            const char *expected, const char *actual) {
+    unsigned char digest[SHA256_SIZE];
+    char hex[SHA256_HEX_SIZE];
+    sha256(source, size, digest);
+    hash_to_hex(digest, SHA256_SIZE, hex);
+
+    size_t offset = 0;
+    if (expected && actual) {
+        while (expected[offset] && expected[offset] == actual[offset]) offset++;
+        fprintf(stderr, "Warning: Engine mismatch (%s vs %s) for input sha256:%s at output byte %zu\n",
+                engine_name(primary), engine_name(shadow), hex, offset);
+    } else {
+        fprintf(stderr, "Warning: Engine mismatch (%s vs %s) for input sha256:%s: %s engine failed\n",
+                engine_name(primary), engine_name(shadow), hex,
+                engine_name(actual ? shadow : primary));
+    }
+}
+
+// Strip with the selected engine into buffer (NULL: a new heap buffer)
+static char* strip_sampled(const char *source, size_t size, char *buffer, AST **ast) {
+    Engine primary = selected_engine;
+    int sampled = take_sample();
+    double start = sampled ? now_ms() : 0;
+
+    AST *primary_ast = engine_lex(primary, source, size);
+    char *result = NULL;
+    if (primary_ast && buffer) {
+        result = engine_parse_into(primary, primary_ast, source, buffer) != SIZE_MAX ? buffer : NULL;
+    } else if (primary_ast) {
+        result = engine_parse(primary, primary_ast, source);
+    }
+
+    if (sampled) {
+        double primary_ms = now_ms() - start;
+        Engine shadow = primary == ENGINE_REFERENCE ? engine_resolve(ENGINE_AUTO) : ENGINE_REFERENCE;
+
+        start = now_ms();
+        char *expected = strip_types_engine(shadow, source, size);
+        double shadow_ms = now_ms() - start;
+
+        int match = (!result && !expected) || (result && expected && strcmp(result, expected) == 0);
+        if (!match) {
+            report_mismatch(primary, shadow, source, size, expected, result);
+        }
+        free(expected);
+
+        pthread_mutex_lock(&stats_lock);
+        stats.shadow_runs++;
+        stats.mismatches += !match;
+        stats.primary_ms += primary_ms;
+        stats.shadow_ms += shadow_ms;
+        pthread_mutex_unlock(&stats_lock);
+    }
+
+    pthread_mutex_lock(&stats_lock);
+    stats.runs++;
+    pthread_mutex_unlock(&stats_lock);
+
+    if (ast && result) {
+        *ast = primary_ast;
+    } else {
+        ast_free(primary_ast);
+        if (ast) *ast = NULL;
+    }
+    return result;
+}
+
+char* engine_strip(const char *source, size_t size, AST **ast) {
+    return strip_sampled(source, size, NULL, ast);
+}
+
+size_t engine_strip_into(const char *source, size_t size, char *buffer, AST **ast) {
+    return strip_sampled(source, size, buffer, ast) ? strlen(buffer) : SIZE_MAX;
+}
+
+int engine_strip_sink(const char *source, size_t size, OutputSink sink, void *context) {
+    if (size == 0) {
+        return 0;  // Nothing to write
+    }
+
+    if (shadow_rate > 0) {
+        // Comparing with the shadow engine needs the whole output
+        char *result = strip_sampled(source, size, NULL, NULL);
+        if (!result) return -1;
+        // Sinks copy whatever they keep past the call, so result can go
+        int status = sink(context, result, strlen(result)) ? -1 : 0;
+        free(result);
+        return status;
+    }
+
+    AST *ast = engine_lex(selected_engine, source, size);
+    int status = -1;
+    if (ast) {
+        status = selected_engine == ENGINE_REFERENCE ? parse_sink(ast, source, sink, context)
+                                                     : parse_fast_sink(ast, source, sink, context);
+    }
+    ast_free(ast);
+
+    pthread_mutex_lock(&stats_lock);
+    stats.runs++;
+    pthread_mutex_unlock(&stats_lock);
+    return status;
+}
+
+void engine_stats(EngineStats *out) {
+    pthread_mutex_lock(&stats_lock);
+    *out = stats;
+    pthread_mutex_unlock(&stats_lock);
+}
@@ -0,0 +1,73 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "analyzer.h"
+
+// Stripping engines; all of them produce byte-identical output
+typedef enum {
+    ENGINE_REFERENCE,        // lex() + parse()
+    ENGINE_FAST,             // Byte-class lexer, span-copying parser
+    ENGINE_STRUCTURAL,       // Bitmap index lexer (SIMD), span-copying parser
+    ENGINE_THREADED,         // Computed-goto state machine, span-copying parser
+    ENGINE_AUTO              // Fastest engine available on this machine
+} Engine;
+
+// Counters since process start
+typedef struct {
+    size_t runs;             // Inputs stripped through engine_strip()
+    size_t shadow_runs;      // Of which also stripped by the shadow engine
+    size_t mismatches;       // Shadow runs whose outputs differed
+    double primary_ms;       // Selected engine's time on shadowed inputs
+    double shadow_ms;        // Shadow engine's time on the same inputs
+} EngineStats;
+
+// Parse "reference", "fast", "structural", "threaded" or "auto"; returns -1 for unknown names
+int engine_from_name(const char *name, Engine *engine);
+
+const char* engine_name(Engine engine);
+
+// Concrete engine that ENGINE_AUTO stands for
+Engine engine_resolve(Engine engine);
+
+// Select the engine used by engine_strip() and the fraction (0..1) of
+// inputs also run on a shadow engine (the reference engine, or the auto
+// one when the reference is selected) to compare outputs and timings.
+// Call before any worker threads start.
+void engine_configure(Engine engine, double shadow_rate);
+
+// Engine selected by engine_configure() (ENGINE_AUTO resolved)
+Engine engine_selected(void);
+
+// Lex and parse with a specific engine
+AST* engine_lex(Engine engine, const char *source, size_t size);
+char* engine_parse(Engine engine, const AST *ast, const char *source);
+
+// Parse into buffer, which must hold the source size + 1 bytes (no rule
+// lengthens the text); returns the output length or SIZE_MAX on failure
+size_t engine_parse_into(Engine engine, const AST *ast, const char *source, char *buffer);
+
+// Strip types with a specific engine (caller frees the result)
+char* strip_types_engine(Engine engine, const char *source, size_t size);
+
+// Strip with the selected engine, shadowing sampled inputs; mismatches are
+// logged to stderr with the input's SHA-256. When ast is not NULL it
+// receives the selected engine's AST (free with ast_free()).
+char* engine_strip(const char *source, size_t size, AST **ast);
+
+// engine_strip() into buffer (size + 1 bytes), e.g. a mapped output file
+// Returns the output length or SIZE_MAX on failure
+size_t engine_strip_into(const char *source, size_t size, char *buffer, AST **ast);
+
+// engine_strip() pushing the output to sink: through parse_sink() for the
+// reference engine, and for the others with unchanged source spans passed
+// by reference; shadowed inputs are stripped into a buffer first and sent
+// as one chunk
+// Returns 0, or -1 when stripping failed or the sink stopped
+int engine_strip_sink(const char *source, size_t size, OutputSink sink, void *context);
+
+// Snapshot of the counters
+void engine_stats(EngineStats *stats);
+
+#endif // ENGINE_H
@@ -0,0 +1,405 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "exports.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char DEFAULT_NAME[] = "default";
+static const char STAR_NAME[] = "*";
+
+static int add_symbol(ExportList *list, const char *name, size_t name_length,
+                      const char *from, size_t from_length, unsigned flags) {
+    if (list->count >= list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 16;
+        ExportedSymbol *symbols = realloc(list->symbols, capacity * sizeof(ExportedSymbol));
+        if (!symbols) return -1;
+        list->symbols = symbols;
+        list->capacity = capacity;
+    }
+
+    ExportedSymbol *symbol = &list->symbols[list->count++];
+    symbol->name = name;
+    symbol->name_length = name_length;
+    symbol->from = from;
+    symbol->from_length = from_length;
+    symbol->flags = flags;
+    return 0;
+}
+
+static int word_eq(const char *text, size_t length, const char *keyword) {
+    return text && length == strlen(keyword) && memcmp(text, keyword, length) == 0;
+}
+
+static char token_char(const SyntaxTree *tree, size_t token) {
+    const Token *t = &tree->ast->tokens[token];
+    return t->type == TOKEN_CODE ? *t->start : 0;
+}
+
+static int is_declaration(NodeKind kind) {
+    return kind == NODE_INTERFACE || kind == NODE_TYPE_ALIAS || kind == NODE_FUNCTION ||
+           kind == NODE_CLASS || kind == NODE_VARIABLE;
+}
+
+static int is_type_kind(NodeKind kind) {
+    return kind == NODE_INTERFACE || kind == NODE_TYPE_ALIAS;
+}
+
+// Whether a top-level name is declared only as an interface or type alias
+static int is_type_name(const SyntaxTree *tree, const char *name, size_t length) {
+    const Node *root = &tree->nodes[tree->root];
+    int has_type = 0;
+    int has_value = 0;
+
+    for (uint32_t i = 0; i < root->child_count; i++) {
+        const Node *node = &tree->nodes[root->first_child + i];
+        if (node->kind == NODE_EXPORT && node->child_count == 1) {
+            node = &tree->nodes[node->first_child];
+        }
+        if (!is_declaration((NodeKind)node->kind) || node->name_offset == NODE_NONE) continue;
+        if (node->name_length != length || memcmp(tree->source + node->name_offset, name, length) != 0) continue;
+
+        if (is_type_kind((NodeKind)node->kind)) {
+            has_type = 1;
+        } else {
+            has_value = 1;
+        }
+    }
+    return has_type && !has_value;
+}
+
+// Specifier of "... from 'x'" inside an export statement
+static const Token* find_from(const SyntaxTree *tree, const Node *node) {
+    int after_from = 0;
+    size_t i = node->first_token;
+    while (i < node->end_token && i < tree->ast->count) {
+        const Token *t = &tree->ast->tokens[i];
+        const char *text;
+        size_t length;
+        size_t next = tree_read_word(tree, i, &text, &length);
+        if (text) {
+            after_from = word_eq(text, length, "from");
+            i = next;
+            continue;
+        }
+
+        if (t->type == TOKEN_STRING && after_from && t->length >= 2) return t;
+        if (tree_next_significant(tree, i) == i) after_from = 0;
+        i++;
+    }
+    return NULL;
+}
+
+// export { a, type B, c as d } [from "x"]
+static int collect_list(const SyntaxTree *tree, size_t pos, size_t end, int list_type_only,
+                        const Token *from, ExportList *list) {
+    const char *from_text = from ? from->start + 1 : NULL;
+    size_t from_length = from ? from->length - 2 : 0;
+
+    pos = tree_next_significant(tree, pos + 1);  // Past {
+    while (pos < end && token_char(tree, pos) != '}') {
+        const char *local;
+        size_t local_length;
+        size_t after = tree_read_word(tree, pos, &local, &local_length);
+        if (!local) {
+            pos = tree_next_significant(tree, pos + 1);
+            continue;
+        }
+
+        int type_only = list_type_only;
+        const char *word;
+        size_t word_length;
+        size_t next = tree_next_significant(tree, after);
+        size_t next_after = tree_read_word(tree, next, &word, &word_length);
+        if (word_eq(local, local_length, "type") && word && !word_eq(word, word_length, "as")) {
+            type_only = 1;
+            local = word;
+            local_length = word_length;
+            next = tree_next_significant(tree, next_after);
+            next_after = tree_read_word(tree, next, &word, &word_length);
+        }
+
+        const char *exported = local;
+        size_t exported_length = local_length;
+        if (word_eq(word, word_length, "as")) {
+            next = tree_next_significant(tree, next_after);
+            next_after = tree_read_word(tree, next, &exported, &exported_length);
+            if (!exported) {
+                exported = local;
+                exported_length = local_length;
+            }
+            next = tree_next_significant(tree, next_after);
+        }
+
+        if (!from && is_type_name(tree, local, local_length)) type_only = 1;
+
+        if (add_symbol(list, exported, exported_length, from_text, from_length,
+                       type_only ? EXPORT_TYPE_ONLY : 0) != 0) {
+            return -1;
+        }
+
+        // Continue after the separating comma
+        pos = next;
+        while (pos < end && token_char(tree, pos) != ',' && token_char(tree, pos) != '}') pos++;
+        if (pos < end && token_char(tree, pos) == ',') pos = tree_next_significant(tree, pos + 1);
+    }
+    return 0;
+}
+
+// Export statement without a parsed declaration child
+static int collect_statement(const SyntaxTree *tree, const Node *node, ExportList *list) {
+    const char *text;
+    size_t length;
+    size_t pos = tree_read_word(tree, node->first_token, &text, &length);  // export
+    pos = tree_next_significant(tree, pos);
+
+    if (node->flags & NODE_FLAG_DEFAULT) {
+        return add_symbol(list, DEFAULT_NAME, strlen(DEFAULT_NAME), NULL, 0, EXPORT_DEFAULT);
+    }
+
+    int type_only = (node->flags & NODE_FLAG_TYPE_ONLY) != 0;
+    if (type_only) {
+        pos = tree_next_significant(tree, tree_read_word(tree, pos, &text, &length));
+    }
+
+    const Token *from = find_from(tree, node);
+    const char *from_text = from ? from->start + 1 : NULL;
+    size_t from_length = from ? from->length - 2 : 0;
+    unsigned flags = type_only ? EXPORT_TYPE_ONLY : 0;
+
+    char c = token_char(tree, pos);
+    if (c == '{') {
+        return collect_list(tree, pos, node->end_token, type_only, from, list);
+    }
+
+    if (c == '*') {
+        // export * as ns from "x" / export * from "x"
+        const char *name;
+        size_t name_length;
+        size_t next = tree_next_significant(tree, pos + 1);
+        size_t after = tree_read_word(tree, next, &text, &length);
+        if (word_eq(text, length, "as")) {
+            tree_read_word(tree, tree_next_significant(tree, after), &name, &name_length);
+            if (name) return add_symbol(list, name, name_length, from_text, from_length, flags);
+        }
+        return add_symbol(list, STAR_NAME, strlen(STAR_NAME), from_text, from_length, flags | EXPORT_STAR);
+    }
+
+    // export declare ..., export const enum E, export enum E, export namespace N
+    for (;;) {
+        size_t after = tree_read_word(tree, pos, &text, &length);
+        if (!text) return 0;
+        pos = tree_next_significant(tree, after);
+
+        if (word_eq(text, length, "declare") || word_eq(text, length, "abstract") ||
+            word_eq(text, length, "async")) {
+            continue;
+        }
+
+        // const enum E vs const name
+        if (word_eq(text, length, "const")) {
+            const char *next;
+            size_t next_length;
+            tree_read_word(tree, pos, &next, &next_length);
+            if (word_eq(next, next_length, "enum")) continue;
+            if (next) return add_symbol(list, next, next_length, NULL, 0, 0);
+            return 0;
+        }
+        if (word_eq(text, length, "enum") || word_eq(text, length, "namespace") ||
+            word_eq(text, length, "module") || word_eq(text, length, "function") ||
+            word_eq(text, length, "class") || word_eq(text, length, "let") ||
+            word_eq(text, length, "var")) {
+            tree_read_word(tree, pos, &text, &length);
+            if (text) return add_symbol(list, text, length, NULL, 0, 0);
+        }
+        return 0;
+    }
+}
+
+int exports_collect(const SyntaxTree *tree, ExportList *list) {
+    list->symbols = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    if (!tree || tree->root == NODE_NONE) return -1;
+
+    const Node *root = &tree->nodes[tree->root];
+    for (uint32_t i = 0; i < root->child_count; i++) {
+        const Node *node = &tree->nodes[root->first_child + i];
+        if (node->kind != NODE_EXPORT) continue;
+
+        const Node *decl = node->child_count == 1 ? &tree->nodes[node->first_child] : NULL;
+        int status;
+        if (decl && is_declaration((NodeKind)decl->kind)) {
+            unsigned flags = is_type_kind((NodeKind)decl->kind) ? EXPORT_TYPE_ONLY : 0;
+            if (node->flags & NODE_FLAG_DEFAULT) {
+                status = add_symbol(list, DEFAULT_NAME, strlen(DEFAULT_NAME), NULL, 0, flags | EXPORT_DEFAULT);
+            } else if (decl->name_offset != NODE_NONE) {
+                status = add_symbol(list, tree->source + decl->name_offset, decl->name_length, NULL, 0, flags);
+            } else {
+                status = 0;
+            }
+        } else {
+            status = collect_statement(tree, node, list);
+        }
+
+        if (status != 0) {
+            exports_free(list);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void exports_free(ExportList *list) {
+    free(list->symbols);
+    list->symbols = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
+
+// ============================================================================
+// Combined index file
+// ============================================================================
+
+int index_module_init(IndexModule *module, const char *path, const ExportList *list) {
+    size_t bytes = 0;
+    for (size_t i = 0; i < list->count; i++) {
+        bytes += list->symbols[i].name_length + list->symbols[i].from_length;
+    }
+
+    module->path = strdup(path);
+    module->symbols = malloc((list->count ? list->count : 1) * sizeof(ExportedSymbol));
+    module->strings = malloc(bytes ? bytes : 1);
+    module->count = list->count;
+    if (!module->path || !module->symbols || !module->strings) {
+        index_module_free(module);
+        return -1;
+    }
+
+    char *out = module->strings;
+    for (size_t i = 0; i < list->count; i++) {
+        const ExportedSymbol *symbol = &list->symbols[i];
+        ExportedSymbol *copy = &module->symbols[i];
+        *copy = *symbol;
+
+        memcpy(out, symbol->name, symbol->name_length);
+        copy->name = out;
+        out += symbol->name_length;
+
+        if (symbol->from) {
+            memcpy(out, symbol->from, symbol->from_length);
+            copy->from = out;
+            out += symbol->from_length;
+        }
+    }
+    return 0;
+}
+
+void index_module_free(IndexModule *module) {
+    free(module->path);
+    free(module->symbols);
+    free(module->strings);
+    module->path = NULL;
+    module->symbols = NULL;
+    module->strings = NULL;
+    module->count = 0;
+}
+
+static int compare_modules(const void *a, const void *b) {
+    return strcmp(((const IndexModule*)a)->path, ((const IndexModule*)b)->path);
+}
+
+static void put_u32(unsigned char *out, uint32_t value) {
+    out[0] = (unsigned char)value;
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+int export_index_write(const char *filepath, IndexModule *modules, size_t count) {
+    qsort(modules, count, sizeof(IndexModule), compare_modules);
+
+    size_t symbol_count = 0;
+    size_t string_bytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        symbol_count += modules[i].count;
+        string_bytes += strlen(modules[i].path);
+        for (size_t j = 0; j < modules[i].count; j++) {
+            string_bytes += modules[i].symbols[j].name_length + modules[i].symbols[j].from_length;
+        }
+    }
+
+    size_t header_size = 32;
+    size_t module_offset = header_size;
+    size_t symbol_offset = module_offset + count * 16;
+    size_t string_offset = symbol_offset + symbol_count * 20;
+    size_t total = string_offset + string_bytes;
+    if (total > UINT32_MAX) {
+        fprintf(stderr, "Error: Export index too large\n");
+        return -1;
+    }
+
+    unsigned char *buffer = calloc(1, total);
+    if (!buffer) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+
+    memcpy(buffer, EXPORT_INDEX_MAGIC, 8);
+    put_u32(buffer + 8, EXPORT_INDEX_VERSION);
+    put_u32(buffer + 12, (uint32_t)count);
+    put_u32(buffer + 16, (uint32_t)symbol_count);
+    put_u32(buffer + 20, (uint32_t)string_bytes);
+
+    unsigned char *strings = buffer + string_offset;
+    size_t string_used = 0;
+    size_t symbol_index = 0;
+    for (size_t i = 0; i < count; i++) {
+        const IndexModule *module = &modules[i];
+        size_t path_length = strlen(module->path);
+
+        unsigned char *record = buffer + module_offset + i * 16;
+        put_u32(record, (uint32_t)string_used);
+        put_u32(record + 4, (uint32_t)path_length);
+        put_u32(record + 8, (uint32_t)symbol_index);
+        put_u32(record + 12, (uint32_t)module->count);
+        memcpy(strings + string_used, module->path, path_length);
+        string_used += path_length;
+
+        for (size_t j = 0; j < module->count; j++, symbol_index++) {
+            const ExportedSymbol *symbol = &module->symbols[j];
+            unsigned char *entry = buffer + symbol_offset + symbol_index * 20;
+
+            put_u32(entry, (uint32_t)string_used);
+            put_u32(entry + 4, (uint32_t)symbol->name_length);
+            memcpy(strings + string_used, symbol->name, symbol->name_length);
+            string_used += symbol->name_length;
+
+            if (symbol->from) {
+                put_u32(entry + 8, (uint32_t)string_used);
+                put_u32(entry + 12, (uint32_t)symbol->from_length);
+                memcpy(strings + string_used, symbol->from, symbol->from_length);
+                string_used += symbol->from_length;
+            } else {
+                put_u32(entry + 8, EXPORT_INDEX_NONE);
+                put_u32(entry + 12, 0);
+            }
+            put_u32(entry + 16, symbol->flags);
+        }
+    }
+
+    FILE *file = fopen(filepath, "wb");
+    if (!file) {
+        fprintf(stderr, "Error: Cannot open file '%s' for writing\n", filepath);
+        free(buffer);
+        return -1;
+    }
+
+    int status = fwrite(buffer, 1, total, file) == total ? 0 : -1;
+    if (fclose(file) != 0) status = -1;
+    if (status != 0) {
+        fprintf(stderr, "Error: Cannot write export index '%s'\n", filepath);
+    }
+    free(buffer);
+    return status;
+}
@@ -0,0 +1,68 @@
+#ifndef EXPORTS_H
+#define EXPORTS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "tree.h"
+
+// Exported symbol flags
+#define EXPORT_TYPE_ONLY  0x01   // interface, type alias or export type
+#define EXPORT_DEFAULT    0x02   // export default
+#define EXPORT_STAR       0x04   // export * from "x" (name is "*")
+
+// Name exported by a module
+typedef struct {
+    const char *name;        // Exported name (points into the source)
+    size_t name_length;
+    const char *from;        // Specifier for re-exports, NULL otherwise
+    size_t from_length;
+    unsigned flags;
+} ExportedSymbol;
+
+typedef struct {
+    ExportedSymbol *symbols;
+    size_t count;
+    size_t capacity;
+} ExportList;
+
+// Collect the exports of a module from its syntax tree
+int exports_collect(const SyntaxTree *tree, ExportList *list);
+
+// Free the symbol array (names are not owned)
+void exports_free(ExportList *list);
+
+// ============================================================================
+// Combined index file
+// ============================================================================
+//
+// Little-endian layout, every field a uint32 unless noted:
+//
+//   header   magic[8] "TSEXPIDX", version, module_count, symbol_count,
+//            string_bytes, reserved[2]
+//   modules  module_count x { path_offset, path_length, first_symbol, symbol_count }
+//            sorted by path so lookups can binary search
+//   symbols  symbol_count x { name_offset, name_length, from_offset, from_length, flags }
+//            from_offset is EXPORT_INDEX_NONE for local exports
+//   strings  string_bytes of UTF-8, offsets are relative to its start
+
+#define EXPORT_INDEX_MAGIC   "TSEXPIDX"
+#define EXPORT_INDEX_VERSION 1
+#define EXPORT_INDEX_NONE    UINT32_MAX
+
+// One module's exports with owned copies of all strings
+typedef struct {
+    char *path;
+    ExportedSymbol *symbols; // Names point into strings
+    size_t count;
+    char *strings;
+} IndexModule;
+
+// Deep-copy an export list for the index
+int index_module_init(IndexModule *module, const char *path, const ExportList *list);
+
+void index_module_free(IndexModule *module);
+
+// Write the combined index (modules are sorted in place)
+int export_index_write(const char *filepath, IndexModule *modules, size_t count);
+
+#endif // EXPORTS_H
@@ -0,0 +1,487 @@
+#include "lexer.h"
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// Fast engine: the reference lexer and parser with the same decisions, but
+// plain code bytes dispatch on a byte-class table instead of running every
+// keyword comparison, strings and comments are scanned in bulk, and output
+// is copied in contiguous spans instead of one formatted character at a time.
+
+// Bytes that need more than a plain TOKEN_CODE in code context
+enum {
+    CLASS_PLAIN = 0,
+    CLASS_SPECIAL = 1
+};
+
+static const unsigned char byte_class[256] = {
+    ['i'] = CLASS_SPECIAL, ['e'] = CLASS_SPECIAL, ['t'] = CLASS_SPECIAL,
+    ['a'] = CLASS_SPECIAL, ['p'] = CLASS_SPECIAL, [';'] = CLASS_SPECIAL,
+    ['"'] = CLASS_SPECIAL, ['\''] = CLASS_SPECIAL, ['`'] = CLASS_SPECIAL,
+    ['/'] = CLASS_SPECIAL, ['?'] = CLASS_SPECIAL, [':'] = CLASS_SPECIAL,
+    ['<'] = CLASS_SPECIAL, ['>'] = CLASS_SPECIAL, ['='] = CLASS_SPECIAL,
+};
+
+static inline void emit(AST *ast, TokenType type, const char *start, size_t length, int line) {
+    // ast_create sized the array for one token per byte
+    Token *token = &ast->tokens[ast->count++];
+    token->type = type;
+    token->start = start;
+    token->length = length;
+    token->line = line;
+}
+
+// Keyword at ptr followed by a non-identifier byte (or the end)
+static inline int keyword_at(const char *ptr, const char *end, const char *word, size_t length) {
+    if ((size_t)(end - ptr) < length || memcmp(ptr, word, length) != 0) return 0;
+    return ptr + length >= end || (!isalnum(ptr[length]) && ptr[length] != '_');
+}
+
+static inline int prefix_at(const char *ptr, const char *end, const char *prefix, size_t length) {
+    return (size_t)(end - ptr) >= length && memcmp(ptr, prefix, length) == 0;
+}
+
+AST* lex_fast(const char *source, size_t size) {
+    if (!source || size == 0) {
+        return NULL;
+    }
+
+    AST *ast = ast_create(size);
+    if (!ast) return NULL;
+
+    const char *ptr = source;
+    const char *end = source + size;
+    int line = 1;
+    DepState deps = {0, DEP_IMPORT, 0};
+
+    while (ptr < end) {
+        char current = *ptr;
+
+        if (byte_class[(unsigned char)current] == CLASS_PLAIN) {
+            emit(ast, TOKEN_CODE, ptr, 1, line);
+            if (current == '\n') line++;
+            ptr++;
+            continue;
+        }
+
+        char next = (ptr + 1 < end) ? ptr[1] : '\0';
+        switch (current) {
+            case 'i':
+                dep_note_keyword(&deps, source, ptr, end);
+                if (keyword_at(ptr, end, "interface", 9)) {
+                    emit(ast, TOKEN_INTERFACE, ptr, 9, line);
+                    ptr += 9;
+                    continue;
+                }
+                if (prefix_at(ptr, end, "implements ", 11)) {
+                    emit(ast, TOKEN_IMPLEMENTS, ptr, 10, line);
+                    ptr += 10;
+                    continue;
+                }
+                break;
+
+            case 'e':
+                dep_note_keyword(&deps, source, ptr, end);
+                break;
+
+            case ';':
+                deps.pending = 0;
+                break;
+
+            case 't':
+                if (prefix_at(ptr, end, "type ", 5)) {
+                    emit(ast, TOKEN_TYPE, ptr, 4, line);
+                    ptr += 4;
+                    continue;
+                }
+                break;
+
+            case 'a':
+                if (ptr + 3 < end && ptr > source && ptr[-1] == ' ' && memcmp(ptr, "as ", 3) == 0) {
+                    emit(ast, TOKEN_AS, ptr, 2, line);
+                    ptr += 2;
+                    continue;
+                }
+                break;
+
+            case 'p':
+                if (keyword_at(ptr, end, "private", 7)) {
+                    emit(ast, TOKEN_PRIVATE, ptr, 7, line);
+                    ptr += 7;
+                    continue;
+                }
+                break;
+
+            case '"':
+            case '\'':
+            case '`': {
+                if (ptr > source && ptr[-1] == '\\') break;
+
+                // Closing delimiter not preceded by a backslash
+                const char *literal = ptr;
+                const char *close = ptr + 1;
+                for (;;) {
+                    close = memchr(close, current, end - close);
+                    if (!close || close[-1] != '\\') break;
+                    close++;
+                }
+                if (!close) {
+                    ptr = end;  // Unterminated: the reference emits nothing
+                    continue;
+                }
+                ptr = close + 1;
+                emit(ast, TOKEN_STRING, literal, ptr - literal, line);
+                dep_note_string(ast, &deps, source, literal, ptr, end, line);
+                continue;
+            }
+
+            case '/':
+                if (next == '*') {
+                    const char *comment = ptr;
+                    const char *scan = ptr + 2;
+                    while (scan < end && !(scan[0] == '*' && scan + 1 < end && scan[1] == '/')) {
+                        if (*scan == '\n') line++;
+                        scan++;
+                    }
+                    if (scan >= end) {
+                        ptr = end;
+                        continue;
+                    }
+                    ptr = scan + 2;
+                    emit(ast, TOKEN_BLOCK_COMMENT, comment, ptr - comment, line);
+                    continue;
+                }
+                if (next == '/') {
+                    const char *newline = memchr(ptr + 2, '\n', end - (ptr + 2));
+                    if (!newline) {
+                        ptr = end;
+                        continue;
+                    }
+                    emit(ast, TOKEN_LINE_COMMENT, ptr, newline - ptr, line);
+                    // The reference counts this newline twice
+                    line += 2;
+                    ptr = newline + 1;
+                    continue;
+                }
+                break;
+
+            case '?':
+                if (next == ':') {
+                    emit(ast, TOKEN_OPTIONAL, ptr, 2, line);
+                    ptr += 2;
+                    continue;
+                }
+                break;
+
+            case ':': {
+                const char *check = ptr - 1;
+                while (check >= source && isspace(*check)) check--;
+                if (check >= source && (isalnum(*check) || *check == '_' || *check == ')' || *check == ']')) {
+                    emit(ast, TOKEN_COLON, ptr, 1, line);
+                    ptr++;
+                    continue;
+                }
+                break;
+            }
+
+            case '<':
+                emit(ast, TOKEN_LT, ptr, 1, line);
+                ptr++;
+                continue;
+
+            case '>':
+                emit(ast, TOKEN_GT, ptr, 1, line);
+                ptr++;
+                continue;
+
+            case '=':
+                emit(ast, TOKEN_EQ, ptr, 1, line);
+                ptr++;
+                continue;
+        }
+
+        emit(ast, TOKEN_CODE, ptr, 1, line);
+        ptr++;
+    }
+
+    emit(ast, TOKEN_EOF, ptr, 0, line);
+    classify_colons(ast);
+    return ast;
+}
+
+// Output that batches adjacent source bytes into one span, then either
+// copies it into buffer or hands it to a sink as it stands
+typedef struct {
+    char *buffer;
+    size_t size;
+    const char *run;         // Pending source span not yet copied
+    size_t run_length;
+    OutputSink sink;         // Instead of buffer when set
+    void *context;
+    int drop_nul;            // Source has NULs, which the reference drops
+    int stopped;             // The sink returned nonzero
+} SpanWriter;
+
+// Hand data to the sink, leaving out NULs like the reference
+static void writer_deliver(SpanWriter *w, const char *data, size_t length) {
+    while (length && !w->stopped) {
+        const char *nul = w->drop_nul ? memchr(data, '\0', length) : NULL;
+        size_t piece = nul ? (size_t)(nul - data) : length;
+        if (piece && w->sink(w->context, data, piece) != 0) w->stopped = 1;
+        if (!nul) break;
+        length -= piece + 1;
+        data = nul + 1;
+    }
+}
+
+static inline void writer_flush(SpanWriter *w) {
+    if (w->run_length) {
+        if (w->sink) {
+            writer_deliver(w, w->run, w->run_length);
+        } else {
+            memcpy(w->buffer + w->size, w->run, w->run_length);
+        }
+        w->size += w->run_length;
+        w->run_length = 0;
+    }
+}
+
+static inline void writer_span(SpanWriter *w, const char *start, size_t length) {
+    if (w->run_length && w->run + w->run_length == start) {
+        w->run_length += length;
+        return;
+    }
+    writer_flush(w);
+    w->run = start;
+    w->run_length = length;
+}
+
+// One inserted space (not from the source)
+static inline void writer_space(SpanWriter *w) {
+    writer_flush(w);
+    if (w->sink) {
+        writer_deliver(w, " ", 1);
+    } else {
+        w->buffer[w->size] = ' ';
+    }
+    w->size++;
+}
+
+static inline int is_space_token(const Token *token) {
+    char c = *token->start;
+    return isspace(c) || c == '\n';
+}
+
+// The stripping rules, writing through w
+static void parse_spans(const AST *ast, SpanWriter *w) {
+    const Token *tokens = ast->tokens;
+    size_t count = ast->count;
+
+    for (size_t i = 0; i < count && !w->stopped; i++) {
+        const Token *token = &tokens[i];
+
+        switch (token->type) {
+            case TOKEN_STRING:
+            case TOKEN_BLOCK_COMMENT:
+            case TOKEN_LINE_COMMENT:
+            case TOKEN_CODE:
+            case TOKEN_GT:
+            case TOKEN_EQ:
+                writer_span(w, token->start, token->length);
+                break;
+
+            case TOKEN_LT: {
+                // Generic if preceded by an identifier or ')' and the
+                // matching '>' is followed by '(', '{' or '='
+                int looks_like_generic = 0;
+                if (i > 0) {
+                    size_t prev = i - 1;
+                    while (prev > 0 && tokens[prev].type == TOKEN_CODE) {
+                        char c = *tokens[prev].start;
+                        if (!isspace(c) && c != '\n') {
+                            if (isalnum(c) || c == '_' || c == ')') {
+                                looks_like_generic = 1;
+                            }
+                            break;
+                        }
+                        prev--;
+                    }
+                }
+
+                if (looks_like_generic) {
+                    int depth = 1;
+                    size_t lookahead = i + 1;
+                    int found_match = 0;
+                    while (lookahead < count && depth > 0) {
+                        if (tokens[lookahead].type == TOKEN_LT) depth++;
+                        else if (tokens[lookahead].type == TOKEN_GT && --depth == 0) {
+                            found_match = 1;
+                            break;
+                        }
+                        lookahead++;
+                    }
+
+                    if (found_match) {
+                        lookahead++;
+                        while (lookahead < count && tokens[lookahead].type == TOKEN_CODE &&
+                               is_space_token(&tokens[lookahead])) {
+                            lookahead++;
+                        }
+                        // Only plain code other than '(' or '{' turns it back into a comparison
+                        if (lookahead < count && tokens[lookahead].type == TOKEN_CODE) {
+                            char c = *tokens[lookahead].start;
+                            looks_like_generic = c == '(' || c == '{';
+                        }
+                    } else {
+                        looks_like_generic = 0;
+                    }
+                }
+
+                if (looks_like_generic) {
+                    int depth = 1;
+                    i++;
+                    while (i < count && depth > 0) {
+                        if (tokens[i].type == TOKEN_LT) depth++;
+                        else if (tokens[i].type == TOKEN_GT && --depth == 0) {
+                            i++;
+                            break;
+                        }
+                        i++;
+                    }
+                    i--;
+                } else {
+                    writer_span(w, token->start, 1);
+                }
+                break;
+            }
+
+            case TOKEN_INTERFACE:
+                i++;
+                while (i < count && tokens[i].type != TOKEN_EOF) {
+                    if (tokens[i].type == TOKEN_CODE) {
+                        char c = *tokens[i].start;
+                        if (c == '{') {
+                            int brace_count = 1;
+                            i++;
+                            while (i < count && brace_count > 0) {
+                                if (tokens[i].type == TOKEN_CODE) {
+                                    if (*tokens[i].start == '{') brace_count++;
+                                    else if (*tokens[i].start == '}') brace_count--;
+                                }
+                                i++;
+                            }
+                            break;
+                        } else if (c == '\n') {
+                            break;
+                        }
+                    }
+                    i++;
+                }
+                i--;
+                break;
+
+            case TOKEN_TYPE:
+                i++;
+                while (i < count && tokens[i].type != TOKEN_EOF) {
+                    if (tokens[i].type == TOKEN_CODE) {
+                        char c = *tokens[i].start;
+                        if (c == ';' || c == '\n') {
+                            if (c == ';') i++;
+                            break;
+                        }
+                    }
+                    i++;
+                }
+                i--;
+                break;
+
+            case TOKEN_COLON:
+                i = skip_type(ast, i + 1) - 1;
+                break;
+
+            case TOKEN_IMPLEMENTS:
+                writer_space(w);
+                writer_space(w);
+                i++;
+                while (i < count && tokens[i].type != TOKEN_EOF) {
+                    if (tokens[i].type == TOKEN_CODE && *tokens[i].start == '{') {
+                        i--;
+                        break;
+                    }
+                    i++;
+                }
+                break;
+
+            case TOKEN_AS:
+                writer_space(w);
+                i++;
+                while (i < count) {
+                    if (tokens[i].type == TOKEN_CODE) {
+                        char c = *tokens[i].start;
+                        if (!isalnum(c) && c != '_' && c != '.' && c != '<' && c != '>') {
+                            i--;
+                            break;
+                        }
+                    }
+                    i++;
+                }
+                break;
+
+            case TOKEN_OPTIONAL:
+                i = skip_type(ast, i + 1) - 1;
+                break;
+
+            case TOKEN_PRIVATE:
+            case TOKEN_EOF:
+                break;
+        }
+    }
+    writer_flush(w);
+}
+
+size_t parse_fast_into(const AST *ast, const char *source, char *buffer) {
+    size_t source_size = (size_t)(ast->tokens[ast->count - 1].start - source);
+    SpanWriter w = { buffer, 0, NULL, 0, NULL, NULL, 0, 0 };
+    parse_spans(ast, &w);
+
+    // The reference emits bytes through "%c" formatting, which drops NULs
+    if (memchr(source, '\0', source_size)) {
+        size_t kept = 0;
+        for (size_t i = 0; i < w.size; i++) {
+            if (w.buffer[i] != '\0') w.buffer[kept++] = w.buffer[i];
+        }
+        w.size = kept;
+    }
+
+    w.buffer[w.size] = '\0';
+    return w.size;
+}
+
+char* parse_fast(const AST *ast, const char *source) {
+    if (!ast || !source) {
+        return NULL;
+    }
+
+    // Every rule replaces text with at most as many bytes
+    size_t source_size = (size_t)(ast->tokens[ast->count - 1].start - source);
+    char *buffer = malloc(source_size + 1);
+    if (!buffer) {
+        return NULL;
+    }
+    large_advise(buffer, source_size + 1, 1);
+    parse_fast_into(ast, source, buffer);
+    return buffer;
+}
+
+int parse_fast_sink(const AST *ast, const char *source, OutputSink sink, void *context) {
+    if (!ast || !source || !sink) {
+        return -1;
+    }
+
+    size_t source_size = (size_t)(ast->tokens[ast->count - 1].start - source);
+    SpanWriter w = { NULL, 0, NULL, 0, sink, context, 0, 0 };
+    w.drop_nul = memchr(source, '\0', source_size) != NULL;
+    parse_spans(ast, &w);
+    return w.stopped ? -1 : 0;
+}
@@ -0,0 +1,181 @@
+#include "input.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Input pre-pass: one read of the buffer validates UTF-8, counts lines and
+// looks for anything the stripper would change. Source code is nearly all
+// ASCII, so whole 16-byte ASCII blocks are settled from their masks and only
+// blocks holding a byte >= 0x80 walk their multi-byte sequences.
+
+int bom_mode_from_name(const char *name, BomMode *mode) {
+    if (strcmp(name, "keep") == 0) {
+        *mode = BOM_KEEP;
+    } else if (strcmp(name, "strip") == 0) {
+        *mode = BOM_STRIP;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+typedef struct {
+    size_t next;             // First byte not yet validated
+    size_t newlines;
+    int typed;               // Saw a byte the stripper acts on
+    int slash;               // Last byte classified was '/'
+} ScanState;
+
+// Length of the sequence led by s[0] >= 0x80, or 0 when it is invalid
+// (stray continuation, overlong, surrogate, above U+10FFFF or truncated)
+static size_t utf8_length(const unsigned char *s, size_t avail) {
+    unsigned char c = s[0];
+    unsigned char low = 0x80, high = 0xBF;   // Range of the second byte
+    size_t length;
+    if (c >= 0xC2 && c <= 0xDF) {
+        length = 2;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+        length = 3;
+        if (c == 0xE0) low = 0xA0;
+        if (c == 0xED) high = 0x9F;
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        length = 4;
+        if (c == 0xF0) low = 0x90;
+        if (c == 0xF4) high = 0x8F;
+    } else {
+        return 0;
+    }
+
+    if (avail < length || s[1] < low || s[1] > high) return 0;
+    for (size_t k = 2; k < length; k++) {
+        if ((s[k] & 0xC0) != 0x80) return 0;
+    }
+    return length;
+}
+
+// Validate from st->next up to limit (the last sequence may run past it)
+// Returns -1 with *invalid set at the first bad sequence
+static int validate(const unsigned char *s, size_t size, size_t limit, ScanState *st, size_t *invalid) {
+    size_t i = st->next;
+    while (i < limit) {
+        if (s[i] < 0x80) {
+            i++;
+            continue;
+        }
+        size_t length = utf8_length(s + i, size - i);
+        if (length == 0) {
+            *invalid = i;
+            return -1;
+        }
+        i += length;
+    }
+    st->next = i;
+    return 0;
+}
+
+// Newlines and type syntax in s[from, to), one byte at a time
+static void classify_bytes(const unsigned char *s, size_t from, size_t to, ScanState *st) {
+    for (size_t i = from; i < to; i++) {
+        unsigned char c = s[i];
+        if (c == '\n') st->newlines++;
+        if (c == ':' || c == '<' || c == '?' || c == 0 || (st->slash && (c == '/' || c == '*'))) {
+            st->typed = 1;
+        }
+        st->slash = c == '/';
+    }
+}
+
+#ifdef __SSE2__
+static inline unsigned eq_mask(__m128i v, char c) {
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c)));
+}
+#endif
+
+// Whether word occurs anywhere in s
+static int contains(const char *s, size_t size, const char *word) {
+    size_t length = strlen(word);
+    const char *end = s + size;
+    for (const char *p = s; (size_t)(end - p) >= length; p++) {
+        p = memchr(p, word[0], (size_t)(end - p) - length + 1);
+        if (!p) return 0;
+        if (memcmp(p, word, length) == 0) return 1;
+    }
+    return 0;
+}
+
+// Whether every string the lexer opens is closed (it drops unterminated ones)
+static int strings_closed(const char *s, size_t size) {
+    char quote = 0;
+    for (size_t i = 0; i < size; i++) {
+        char c = s[i];
+        if (quote) {
+            if (c == quote && s[i - 1] != '\\') quote = 0;
+        } else if ((c == '"' || c == '\'' || c == '`') && !(i > 0 && s[i - 1] == '\\')) {
+            quote = c;
+        }
+    }
+    return !quote;
+}
+
+// No keyword token and no string the lexer would drop: with no typed byte
+// either, every token is copied through as it stands
+static int is_plain(const char *source, size_t size) {
+    static const char *keywords[] = { "interface", "implements ", "type ", " as ", "private" };
+    for (size_t k = 0; k < sizeof(keywords) / sizeof(keywords[0]); k++) {
+        if (contains(source, size, keywords[k])) return 0;
+    }
+    return strings_closed(source, size);
+}
+
+void input_scan(const char *source, size_t size, InputScan *scan) {
+    const unsigned char *s = (const unsigned char*)source;
+    ScanState st = {0, 0, 0, 0};
+    size_t i = 0;
+
+    scan->bom = size >= 3 && s[0] == 0xEF && s[1] == 0xBB && s[2] == 0xBF ? 3 : 0;
+    scan->invalid = SIZE_MAX;
+    scan->skip = 0;
+
+#ifdef __SSE2__
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+        unsigned high = (unsigned)_mm_movemask_epi8(v);
+        unsigned slash = eq_mask(v, '/');
+        unsigned comment = slash | eq_mask(v, '*');
+        unsigned typed = eq_mask(v, ':') | eq_mask(v, '<') | eq_mask(v, '?') | eq_mask(v, 0);
+
+        st.newlines += (size_t)__builtin_popcount(eq_mask(v, '\n'));
+        // "//" and "/*": a '/' or '*' right after a '/', across blocks too
+        if (typed || (comment & ((slash << 1) | (unsigned)st.slash))) st.typed = 1;
+        st.slash = (slash >> 15) & 1;
+
+        if (!high) {
+            // A sequence from the previous block would have set a high bit here
+            st.next = i + 16;
+        } else if (validate(s, size, i + 16, &st, &scan->invalid) != 0) {
+            break;
+        }
+    }
+#endif
+
+    if (scan->invalid == SIZE_MAX) {
+        classify_bytes(s, i, size, &st);
+        validate(s, size, size, &st, &scan->invalid);
+    }
+
+    scan->lines = st.newlines + (size > 0 && s[size - 1] != '\n');
+    scan->plain = scan->invalid == SIZE_MAX && !st.typed && is_plain(source, size);
+}
+
+int input_check(const char *name, const char *source, size_t size, BomMode mode, InputScan *scan) {
+    input_scan(source, size, scan);
+    if (scan->invalid != SIZE_MAX) {
+        fprintf(stderr, "Error: '%s' is not valid UTF-8 (invalid sequence at byte %zu)\n",
+                name, scan->invalid);
+        return -1;
+    }
+    scan->skip = mode == BOM_STRIP ? scan->bom : 0;
+    return 0;
+}
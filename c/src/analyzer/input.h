@@ -0,0 +1,34 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// What to do with a leading UTF-8 byte order mark
+typedef enum {
+    BOM_KEEP,                // Leave it in the input (and the output)
+    BOM_STRIP                // Drop it before stripping
+} BomMode;
+
+// Parse "keep" or "strip"; returns -1 for unknown names
+int bom_mode_from_name(const char *name, BomMode *mode);
+
+// Facts gathered by one pass over an input
+typedef struct {
+    size_t bom;              // Length of a leading BOM (0 or 3)
+    size_t invalid;          // Offset of the first invalid UTF-8 sequence, SIZE_MAX if none
+    size_t lines;            // Line count (a last line without '\n' counts)
+    int plain;               // No TypeScript and no lexer quirk: stripping returns the input
+    size_t skip;             // Leading bytes to drop before stripping (set by input_check())
+} InputScan;
+
+// Validate UTF-8, find a BOM, count lines and check for type syntax in one
+// read of the buffer (16 bytes at a time with SSE2). When the input is
+// invalid, lines and plain only cover the bytes before the bad sequence.
+void input_scan(const char *source, size_t size, InputScan *scan);
+
+// input_scan() plus the BOM mode; on invalid UTF-8 prints an error naming
+// name with the byte offset and returns -1
+int input_check(const char *name, const char *source, size_t size, BomMode mode, InputScan *scan);
+
+#endif // INPUT_H
@@ -0,0 +1,62 @@
+#ifndef LEXER_H
+#define LEXER_H
+
+#include "analyzer.h"
+
+// Lexer building blocks shared by the stripping engines (not public API)
+
+// Pending import/export statement waiting for its specifier
+typedef struct {
+    int pending;
+    DepKind kind;
+    int type_only;
+} DepState;
+
+// Allocate an AST whose token array holds one token per byte plus EOF
+AST* ast_create(size_t size);
+
+// Append a token, growing the array if needed
+void ast_add_token(AST *ast, TokenType type, const char *start, size_t length, int line);
+
+// Called on 'i'/'e' in code: opens a statement on import/export keywords
+void dep_note_keyword(DepState *ds, const char *source, const char *ptr, const char *end);
+
+// Called when a string literal closes in code context
+void dep_note_string(AST *ast, DepState *ds, const char *source, const char *literal,
+                     const char *literal_end, const char *end, int line);
+
+// Retype colons by context (ternary, property, case and label colons become
+// TOKEN_CODE); every lexer calls this once its tokens are complete
+void classify_colons(AST *ast);
+
+// Index just past the type expression starting at token i (after a
+// TOKEN_COLON); shared by every parser
+size_t skip_type(const AST *ast, size_t i);
+
+// parse() into buffer (source size + 1 bytes) instead of a new string;
+// returns the output length, or SIZE_MAX if it did not fit
+size_t parse_into(const AST *ast, const char *source, char *buffer);
+
+// Fast engine (fast.c): same tokens and output as lex()/parse()
+AST* lex_fast(const char *source, size_t size);
+char* parse_fast(const AST *ast, const char *source);
+
+// parse_fast() into buffer (source size + 1 bytes); returns the output length
+size_t parse_fast_into(const AST *ast, const char *source, char *buffer);
+
+// parse_fast() pushing the output to sink; unchanged runs of the source are
+// passed as pointers into it rather than copied
+int parse_fast_sink(const AST *ast, const char *source, OutputSink sink, void *context);
+
+// Structural engine (structural.c): bitmap index pass, then a walk over the
+// set bits; same tokens as lex(), parsed with parse_fast()
+AST* lex_structural(const char *source, size_t size);
+
+// Whether stage one was built with vector instructions (else a scalar loop)
+int lex_structural_vectorized(void);
+
+// Threaded engine (threaded.c): per-state dispatch tables and computed goto;
+// same tokens as lex(), parsed with parse_fast()
+AST* lex_threaded(const char *source, size_t size);
+
+#endif // LEXER_H
@@ -0,0 +1,368 @@
+#include "lexer.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Structural engine: a two-stage lexer in the style of simdjson. Stage one
+// classifies the whole input 64 bytes at a time into bitmaps (structural
+// characters, unescaped quotes, comment ends, newlines); stage two walks only
+// the set bits, emitting the plain code bytes between them in tight runs.
+// Tokens and output are identical to lex()/parse(); parsing is parse_fast().
+
+// Bitmaps over the input, one bit per byte, one word per 64-byte block
+typedef struct {
+    uint64_t *special;       // Bytes that may start a token other than TOKEN_CODE
+    uint64_t *quote;         // Quotes not preceded by a backslash
+    uint64_t *comment_end;   // '*' of every "*/"
+    uint64_t *newline;
+    size_t words;
+} StructuralIndex;
+
+// Raw masks of one block; bytes past the block are read for two-byte patterns
+typedef struct {
+    uint64_t special;
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t comment_end;
+    uint64_t newline;
+} BlockMasks;
+
+#ifdef __SSE2__
+static inline __m128i eq(__m128i v, char c) {
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+}
+
+static inline uint64_t mask16(__m128i v) {
+    return (uint64_t)(uint16_t)_mm_movemask_epi8(v);
+}
+
+// Classify 64 bytes at p; p[64] must be readable
+static inline void classify_block(const char *p, BlockMasks *m) {
+    memset(m, 0, sizeof(*m));
+    for (int lane = 0; lane < 4; lane++) {
+        __m128i v0 = _mm_loadu_si128((const __m128i*)(p + lane * 16));
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(p + lane * 16 + 1));
+        int shift = lane * 16;
+
+        // Single bytes the lexer always tokenizes
+        __m128i special = _mm_or_si128(_mm_or_si128(eq(v0, ';'), eq(v0, ':')),
+                          _mm_or_si128(_mm_or_si128(eq(v0, '<'), eq(v0, '>')), eq(v0, '=')));
+
+        // Two-byte patterns: comment starts, "?:", and the first two letters of
+        // interface/implements/import, export, type, private and as
+        __m128i slash_next = eq(v1, '/');
+        __m128i pairs = _mm_and_si128(eq(v0, '/'), _mm_or_si128(slash_next, eq(v1, '*')));
+        pairs = _mm_or_si128(pairs, _mm_and_si128(eq(v0, '?'), eq(v1, ':')));
+        pairs = _mm_or_si128(pairs, _mm_and_si128(eq(v0, 'i'), _mm_or_si128(eq(v1, 'n'), eq(v1, 'm'))));
+        pairs = _mm_or_si128(pairs, _mm_and_si128(eq(v0, 'e'), eq(v1, 'x')));
+        pairs = _mm_or_si128(pairs, _mm_and_si128(eq(v0, 't'), eq(v1, 'y')));
+        pairs = _mm_or_si128(pairs, _mm_and_si128(eq(v0, 'p'), eq(v1, 'r')));
+        pairs = _mm_or_si128(pairs, _mm_and_si128(eq(v0, 'a'), eq(v1, 's')));
+        m->special |= mask16(_mm_or_si128(special, pairs)) << shift;
+
+        __m128i quote = _mm_or_si128(_mm_or_si128(eq(v0, '"'), eq(v0, '\'')), eq(v0, '`'));
+        m->quote |= mask16(quote) << shift;
+        m->backslash |= mask16(eq(v0, '\\')) << shift;
+        m->comment_end |= mask16(_mm_and_si128(eq(v0, '*'), slash_next)) << shift;
+        m->newline |= mask16(eq(v0, '\n')) << shift;
+    }
+}
+#else
+static inline void classify_block(const char *p, BlockMasks *m) {
+    memset(m, 0, sizeof(*m));
+    for (int i = 0; i < 64; i++) {
+        char c = p[i];
+        char n = p[i + 1];
+        uint64_t bit = 1ULL << i;
+        int special = c == ';' || c == ':' || c == '<' || c == '>' || c == '=' ||
+                      (c == '/' && (n == '/' || n == '*')) || (c == '?' && n == ':') ||
+                      (c == 'i' && (n == 'n' || n == 'm')) || (c == 'e' && n == 'x') ||
+                      (c == 't' && n == 'y') || (c == 'p' && n == 'r') || (c == 'a' && n == 's');
+        if (special) m->special |= bit;
+        if (c == '"' || c == '\'' || c == '`') m->quote |= bit;
+        if (c == '\\') m->backslash |= bit;
+        if (c == '*' && n == '/') m->comment_end |= bit;
+        if (c == '\n') m->newline |= bit;
+    }
+}
+#endif
+
+// Stage one. Like the other lexers, a quote right after a backslash is
+// escaped: the backslash mask shifted by one, carried across blocks.
+static int build_index(const char *source, size_t size, StructuralIndex *index) {
+    size_t words = size / 64 + 1;
+    uint64_t *bits = malloc(4 * words * sizeof(uint64_t));
+    if (!bits) return -1;
+
+    index->special = bits;
+    index->quote = bits + words;
+    index->comment_end = bits + 2 * words;
+    index->newline = bits + 3 * words;
+    index->words = words;
+
+    uint64_t carry = 0;
+    char tail[64 + 16];
+    for (size_t w = 0; w < words; w++) {
+        size_t offset = w * 64;
+        const char *block = source + offset;
+
+        // The last block (and the one ending exactly at the input end) is
+        // copied into zero padding; NUL matches no pattern
+        if (offset + 64 >= size) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, size - offset);
+            block = tail;
+        }
+
+        BlockMasks m;
+        classify_block(block, &m);
+        uint64_t escaped = (m.backslash << 1) | carry;
+        carry = m.backslash >> 63;
+
+        uint64_t quote = m.quote & ~escaped;
+        index->special[w] = m.special | quote;
+        index->quote[w] = quote;
+        index->comment_end[w] = m.comment_end;
+        index->newline[w] = m.newline;
+    }
+    return 0;
+}
+
+int lex_structural_vectorized(void) {
+#ifdef __SSE2__
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+// First set bit at or after pos and before limit (limit when there is none)
+static inline size_t next_bit(const uint64_t *bits, size_t pos, size_t limit) {
+    if (pos >= limit) return limit;
+    size_t w = pos >> 6;
+    size_t last = (limit - 1) >> 6;
+    uint64_t m = bits[w] & (~0ULL << (pos & 63));
+    while (!m) {
+        if (++w > last) return limit;
+        m = bits[w];
+    }
+    size_t found = (w << 6) + (size_t)__builtin_ctzll(m);
+    return found < limit ? found : limit;
+}
+
+// Set bits in [from, to)
+static inline size_t count_bits(const uint64_t *bits, size_t from, size_t to) {
+    size_t count = 0;
+    while (from < to) {
+        size_t w = from >> 6;
+        uint64_t m = bits[w] >> (from & 63);
+        size_t span = 64 - (from & 63);
+        if (to - from < span) {
+            span = to - from;
+            m &= (1ULL << span) - 1;
+        }
+        count += (size_t)__builtin_popcountll(m);
+        from += span;
+    }
+    return count;
+}
+
+static inline void emit(AST *ast, TokenType type, const char *start, size_t length, int line) {
+    // ast_create sized the array for one token per byte
+    Token *token = &ast->tokens[ast->count++];
+    token->type = type;
+    token->start = start;
+    token->length = length;
+    token->line = line;
+}
+
+// Plain code bytes in [from, to), one TOKEN_CODE each, counting newlines
+static inline void emit_plain(AST *ast, const char *source, const StructuralIndex *index,
+                              size_t from, size_t to, int *line) {
+    while (from < to) {
+        size_t newline = next_bit(index->newline, from, to);
+        size_t stop = newline < to ? newline + 1 : to;
+        int current = *line;
+        for (size_t i = from; i < stop; i++) {
+            emit(ast, TOKEN_CODE, source + i, 1, current);
+        }
+        if (newline < to) (*line)++;
+        from = stop;
+    }
+}
+
+static inline int keyword_at(const char *ptr, const char *end, const char *word, size_t length) {
+    if ((size_t)(end - ptr) < length || memcmp(ptr, word, length) != 0) return 0;
+    return ptr + length >= end || (!isalnum(ptr[length]) && ptr[length] != '_');
+}
+
+static inline int prefix_at(const char *ptr, const char *end, const char *prefix, size_t length) {
+    return (size_t)(end - ptr) >= length && memcmp(ptr, prefix, length) == 0;
+}
+
+// Stage two: the fast engine's decisions, taken only at indexed positions
+AST* lex_structural(const char *source, size_t size) {
+    if (!source || size == 0) {
+        return NULL;
+    }
+
+    StructuralIndex index;
+    if (build_index(source, size, &index) != 0) return NULL;
+
+    AST *ast = ast_create(size);
+    if (!ast) {
+        free(index.special);
+        return NULL;
+    }
+
+    const char *end = source + size;
+    size_t pos = 0;
+    int line = 1;
+    DepState deps = {0, DEP_IMPORT, 0};
+
+    while (pos < size) {
+        size_t at = next_bit(index.special, pos, size);
+        emit_plain(ast, source, &index, pos, at, &line);
+        if (at >= size) break;
+
+        const char *ptr = source + at;
+        char current = *ptr;
+        char next = (ptr + 1 < end) ? ptr[1] : '\0';
+        pos = at + 1;
+
+        switch (current) {
+            case 'i':
+                dep_note_keyword(&deps, source, ptr, end);
+                if (keyword_at(ptr, end, "interface", 9)) {
+                    emit(ast, TOKEN_INTERFACE, ptr, 9, line);
+                    pos = at + 9;
+                    continue;
+                }
+                if (prefix_at(ptr, end, "implements ", 11)) {
+                    emit(ast, TOKEN_IMPLEMENTS, ptr, 10, line);
+                    pos = at + 10;
+                    continue;
+                }
+                break;
+
+            case 'e':
+                dep_note_keyword(&deps, source, ptr, end);
+                break;
+
+            case ';':
+                deps.pending = 0;
+                break;
+
+            case 't':
+                if (prefix_at(ptr, end, "type ", 5)) {
+                    emit(ast, TOKEN_TYPE, ptr, 4, line);
+                    pos = at + 4;
+                    continue;
+                }
+                break;
+
+            case 'a':
+                if (ptr + 3 < end && ptr > source && ptr[-1] == ' ' && memcmp(ptr, "as ", 3) == 0) {
+                    emit(ast, TOKEN_AS, ptr, 2, line);
+                    pos = at + 2;
+                    continue;
+                }
+                break;
+
+            case 'p':
+                if (keyword_at(ptr, end, "private", 7)) {
+                    emit(ast, TOKEN_PRIVATE, ptr, 7, line);
+                    pos = at + 7;
+                    continue;
+                }
+                break;
+
+            case '"':
+            case '\'':
+            case '`': {
+                // Closing delimiter: the next unescaped quote of the same kind
+                size_t close = at + 1;
+                for (;;) {
+                    close = next_bit(index.quote, close, size);
+                    if (close >= size || source[close] == current) break;
+                    close++;
+                }
+                if (close >= size) {
+                    pos = size;  // Unterminated: the reference emits nothing
+                    continue;
+                }
+                pos = close + 1;
+                emit(ast, TOKEN_STRING, ptr, pos - at, line);
+                dep_note_string(ast, &deps, source, ptr, source + pos, end, line);
+                continue;
+            }
+
+            case '/':
+                if (next == '*') {
+                    size_t close = next_bit(index.comment_end, at + 2, size);
+                    line += (int)count_bits(index.newline, at + 2, close);
+                    if (close >= size) {
+                        pos = size;
+                        continue;
+                    }
+                    pos = close + 2;
+                    emit(ast, TOKEN_BLOCK_COMMENT, ptr, pos - at, line);
+                    continue;
+                }
+                if (next == '/') {
+                    size_t newline = next_bit(index.newline, at + 2, size);
+                    if (newline >= size) {
+                        pos = size;
+                        continue;
+                    }
+                    emit(ast, TOKEN_LINE_COMMENT, ptr, newline - at, line);
+                    // The reference counts this newline twice
+                    line += 2;
+                    pos = newline + 1;
+                    continue;
+                }
+                break;
+
+            case '?':
+                if (next == ':') {
+                    emit(ast, TOKEN_OPTIONAL, ptr, 2, line);
+                    pos = at + 2;
+                    continue;
+                }
+                break;
+
+            case ':': {
+                const char *check = ptr - 1;
+                while (check >= source && isspace(*check)) check--;
+                if (check >= source && (isalnum(*check) || *check == '_' || *check == ')' || *check == ']')) {
+                    emit(ast, TOKEN_COLON, ptr, 1, line);
+                    continue;
+                }
+                break;
+            }
+
+            case '<':
+                emit(ast, TOKEN_LT, ptr, 1, line);
+                continue;
+
+            case '>':
+                emit(ast, TOKEN_GT, ptr, 1, line);
+                continue;
+
+            case '=':
+                emit(ast, TOKEN_EQ, ptr, 1, line);
+                continue;
+        }
+
+        emit(ast, TOKEN_CODE, ptr, 1, line);
+    }
+
+    free(index.special);
+    emit(ast, TOKEN_EOF, end, 0, line);
+    classify_colons(ast);
+    return ast;
+}
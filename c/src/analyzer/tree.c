@@ -0,0 +1,670 @@
+#include "tree.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// Builder state; finished siblings wait on the scratch stack until their
+// parent completes, then move into tree->nodes as one contiguous range
+typedef struct {
+    SyntaxTree *tree;
+    const Token *tokens;
+    size_t token_count;
+    size_t pos;
+    uint32_t capacity;
+    Node *scratch;
+    size_t scratch_count;
+    size_t scratch_capacity;
+    int depth;               // Blocks open around the current position
+    int failed;
+} TreeBuilder;
+
+// How scan_rest treats { at depth 0
+typedef enum {
+    SCAN_STATEMENT,          // Blocks after ) / => / else / try / do; may continue with else/catch
+    SCAN_FUNCTION            // First block after the parameter list is the body and ends the node
+} ScanMode;
+
+static void parse_statement(TreeBuilder *b);
+
+// ============================================================================
+// Token helpers
+// ============================================================================
+
+static int is_word_char(char c) {
+    return isalnum((unsigned char)c) || c == '_' || c == '$';
+}
+
+// Single significant character of a token (0 for strings, comments, keywords)
+static char tok_char(const TreeBuilder *b, size_t i) {
+    const Token *t = &b->tokens[i];
+    switch (t->type) {
+        case TOKEN_CODE:
+        case TOKEN_LT:
+        case TOKEN_GT:
+        case TOKEN_EQ:
+        case TOKEN_COLON:
+        case TOKEN_OPTIONAL:
+            return *t->start;
+        default:
+            return 0;
+    }
+}
+
+static int is_trivia(const TreeBuilder *b, size_t i) {
+    const Token *t = &b->tokens[i];
+    if (t->type == TOKEN_BLOCK_COMMENT || t->type == TOKEN_LINE_COMMENT) return 1;
+    return t->type == TOKEN_CODE && isspace((unsigned char)*t->start);
+}
+
+static int at_end(const TreeBuilder *b) {
+    return b->pos >= b->token_count || b->tokens[b->pos].type == TOKEN_EOF;
+}
+
+static void skip_trivia(TreeBuilder *b) {
+    while (!at_end(b) && is_trivia(b, b->pos)) b->pos++;
+}
+
+static size_t next_significant(const TreeBuilder *b, size_t i) {
+    while (i < b->token_count && b->tokens[i].type != TOKEN_EOF && is_trivia(b, i)) i++;
+    return i;
+}
+
+// Word starting at token i; returns the token index after it (i if none)
+static size_t read_word(const TreeBuilder *b, size_t i, const char **text, size_t *length) {
+    *text = NULL;
+    *length = 0;
+    if (i >= b->token_count) return i;
+
+    const Token *t = &b->tokens[i];
+    switch (t->type) {
+        case TOKEN_INTERFACE:
+        case TOKEN_TYPE:
+        case TOKEN_IMPLEMENTS:
+        case TOKEN_AS:
+        case TOKEN_PRIVATE:
+            *text = t->start;
+            *length = t->length;
+            return i + 1;
+        case TOKEN_CODE:
+            break;
+        default:
+            return i;
+    }
+
+    size_t j = i;
+    while (j < b->token_count && b->tokens[j].type == TOKEN_CODE && is_word_char(*b->tokens[j].start)) j++;
+    if (j > i) {
+        *text = t->start;
+        *length = (size_t)(b->tokens[j - 1].start - t->start) + 1;
+    }
+    return j;
+}
+
+static int word_eq(const char *text, size_t length, const char *keyword) {
+    return text && length == strlen(keyword) && memcmp(text, keyword, length) == 0;
+}
+
+static int next_word_is(const TreeBuilder *b, size_t i, const char *keyword) {
+    const char *text;
+    size_t length;
+    read_word(b, next_significant(b, i), &text, &length);
+    return word_eq(text, length, keyword);
+}
+
+// Last significant character ends an unfinished expression
+static int continues_after(char c) {
+    return c && strchr(",=([{+-*/%&|^!~?:.<", c) != NULL;
+}
+
+// Next line starts by continuing the previous expression
+static int continues_before(char c) {
+    return c && strchr(".?:+*&|=,)]>", c) != NULL;
+}
+
+// ============================================================================
+// Node storage
+// ============================================================================
+
+static Node make_node(NodeKind kind, size_t first_token) {
+    Node node;
+    node.kind = (uint8_t)kind;
+    node.flags = 0;
+    node.first_token = (uint32_t)first_token;
+    node.end_token = (uint32_t)first_token;
+    node.name_offset = NODE_NONE;
+    node.name_length = 0;
+    node.first_child = 0;
+    node.child_count = 0;
+    return node;
+}
+
+static void push_node(TreeBuilder *b, const Node *node) {
+    if (b->scratch_count >= b->scratch_capacity) {
+        size_t capacity = b->scratch_capacity ? b->scratch_capacity * 2 : 64;
+        Node *scratch = realloc(b->scratch, capacity * sizeof(Node));
+        if (!scratch) {
+            b->failed = 1;
+            return;
+        }
+        b->scratch = scratch;
+        b->scratch_capacity = capacity;
+    }
+    b->scratch[b->scratch_count++] = *node;
+}
+
+// Move the siblings pushed since mark into the tree as parent's children
+static void finish_children(TreeBuilder *b, size_t mark, Node *parent) {
+    SyntaxTree *tree = b->tree;
+    uint32_t count = (uint32_t)(b->scratch_count - mark);
+
+    if (tree->count + count > b->capacity) {
+        uint32_t capacity = b->capacity;
+        while (tree->count + count > capacity) capacity *= 2;
+        Node *nodes = arena_grow(&tree->arena, tree->nodes, b->capacity * sizeof(Node), capacity * sizeof(Node));
+        if (!nodes) {
+            b->failed = 1;
+            b->scratch_count = mark;
+            return;
+        }
+        tree->nodes = nodes;
+        b->capacity = capacity;
+    }
+
+    if (count) {
+        // Childless nodes may come before any scratch space exists
+        memcpy(tree->nodes + tree->count, b->scratch + mark, count * sizeof(Node));
+    }
+    parent->first_child = tree->count;
+    parent->child_count = count;
+    tree->count += count;
+    b->scratch_count = mark;
+}
+
+static void set_name(TreeBuilder *b, Node *node, size_t i) {
+    const char *text;
+    size_t length;
+    size_t after = read_word(b, next_significant(b, i), &text, &length);
+    if (text) {
+        node->name_offset = (uint32_t)(text - b->tree->source);
+        node->name_length = (uint32_t)length;
+        b->pos = after;
+    }
+}
+
+// ============================================================================
+// Statements
+// ============================================================================
+
+// Statements until the closing } of the enclosing block (left unconsumed)
+static void parse_statements(TreeBuilder *b) {
+    for (;;) {
+        skip_trivia(b);
+        if (at_end(b) || b->failed || tok_char(b, b->pos) == '}') break;
+
+        size_t before = b->pos;
+        parse_statement(b);
+        if (b->pos == before) b->pos++;  // Always make progress
+    }
+}
+
+// Past the } matching the { at the current token, without building nodes
+static void skip_block(TreeBuilder *b) {
+    size_t depth = 0;
+    while (!at_end(b)) {
+        char c = tok_char(b, b->pos++);
+        if (c == '{') depth++;
+        if (c == '}' && --depth == 0) break;
+    }
+}
+
+// { statements } starting at the current token, pushed as a NODE_BLOCK;
+// past TREE_MAX_DEPTH the block is skipped flat and left childless
+static void parse_block(TreeBuilder *b) {
+    Node block = make_node(NODE_BLOCK, b->pos);
+    size_t mark = b->scratch_count;
+
+    if (b->depth >= TREE_MAX_DEPTH) {
+        skip_block(b);
+    } else {
+        b->depth++;
+        b->pos++;
+        parse_statements(b);
+        if (!at_end(b)) b->pos++;  // Closing }
+        b->depth--;
+    }
+
+    finish_children(b, mark, &block);
+    block.end_token = (uint32_t)b->pos;
+    push_node(b, &block);
+}
+
+// Consume the rest of a statement, collecting nested blocks as children
+static void scan_rest(TreeBuilder *b, Node *node, size_t mark, ScanMode mode) {
+    int depth = 0;
+    char last = 0;
+    const char *last_word = NULL;
+    size_t last_word_length = 0;
+    int params_closed = 0;
+
+    while (!at_end(b) && !b->failed) {
+        const Token *t = &b->tokens[b->pos];
+
+        if (t->type == TOKEN_BLOCK_COMMENT) {
+            b->pos++;
+            continue;
+        }
+
+        // Line comment tokens swallow their newline
+        char c = t->type == TOKEN_LINE_COMMENT ? '\n' : tok_char(b, b->pos);
+        if (c == '\n' && depth == 0 && last && !continues_after(last)) {
+            char follow = tok_char(b, next_significant(b, b->pos));
+            if (!continues_before(follow)) {
+                b->pos++;
+                break;
+            }
+        }
+        if (c == ';' && depth == 0) {
+            b->pos++;
+            break;
+        }
+        if (c == '}' && depth == 0) break;
+
+        if (c == '{' && depth == 0) {
+            int is_body = mode == SCAN_FUNCTION
+                ? params_closed
+                : (last == ')' ||
+                   word_eq(last_word, last_word_length, "else") ||
+                   word_eq(last_word, last_word_length, "try") ||
+                   word_eq(last_word, last_word_length, "finally") ||
+                   word_eq(last_word, last_word_length, "do"));
+
+            // Arrow functions: => directly before the brace
+            size_t prev = b->pos;
+            while (prev > 0 && is_trivia(b, prev - 1)) prev--;
+            if (prev >= 2 && b->tokens[prev - 1].type == TOKEN_GT && b->tokens[prev - 2].type == TOKEN_EQ) {
+                is_body = 1;
+            }
+
+            if (is_body) {
+                parse_block(b);
+                last = '}';
+                last_word = NULL;
+                if (mode == SCAN_FUNCTION) break;
+
+                size_t next = next_significant(b, b->pos);
+                if (!(next_word_is(b, next, "else") || next_word_is(b, next, "catch") ||
+                      next_word_is(b, next, "finally"))) {
+                    char follow = tok_char(b, next);
+                    if (follow != ')' && follow != ',' && follow != '.' && follow != ';') break;
+                }
+                continue;
+            }
+        }
+
+        if (c == '(' || c == '[' || c == '{') depth++;
+        if ((c == ')' || c == ']' || c == '}') && depth > 0) {
+            depth--;
+            if (c == ')' && depth == 0) params_closed = 1;
+        }
+
+        if (t->type == TOKEN_STRING) {
+            last = '"';
+            last_word = NULL;
+            b->pos++;
+        } else if (!is_trivia(b, b->pos)) {
+            const char *text;
+            size_t length;
+            size_t after = read_word(b, b->pos, &text, &length);
+            if (text) {
+                last = 'a';
+                last_word = text;
+                last_word_length = length;
+                b->pos = after;
+            } else {
+                last = c;
+                last_word = NULL;
+                b->pos++;
+            }
+        } else {
+            b->pos++;
+        }
+    }
+
+    finish_children(b, mark, node);
+    node->end_token = (uint32_t)b->pos;
+}
+
+// Class member with its modifiers skipped, pushed as a NODE_MEMBER
+static void parse_member(TreeBuilder *b) {
+    static const char *modifiers[] = {
+        "public", "protected", "private", "static", "readonly", "abstract",
+        "async", "get", "set", "declare", "override"
+    };
+
+    Node member = make_node(NODE_MEMBER, b->pos);
+    size_t mark = b->scratch_count;
+
+    for (;;) {
+        skip_trivia(b);
+        const char *text;
+        size_t length;
+        size_t after = read_word(b, b->pos, &text, &length);
+        int is_modifier = 0;
+        for (size_t i = 0; text && i < sizeof(modifiers) / sizeof(modifiers[0]); i++) {
+            if (word_eq(text, length, modifiers[i])) is_modifier = 1;
+        }
+
+        // A modifier word directly followed by ( or : is the member name itself
+        char follow = tok_char(b, next_significant(b, after));
+        if (!is_modifier || follow == '(' || follow == ':' || follow == '=' || follow == ';') {
+            break;
+        }
+        b->pos = after;
+    }
+
+    set_name(b, &member, b->pos);
+    scan_rest(b, &member, mark, SCAN_FUNCTION);
+    push_node(b, &member);
+}
+
+static void parse_class_body(TreeBuilder *b, Node *klass, size_t mark) {
+    // Skip extends/implements up to the body
+    int depth = 0;
+    while (!at_end(b)) {
+        char c = tok_char(b, b->pos);
+        if (c == '{' && depth == 0) break;
+        if (c == '(' || c == '<') depth++;
+        if ((c == ')' || c == '>') && depth > 0) depth--;
+        b->pos++;
+    }
+    if (!at_end(b)) b->pos++;
+
+    for (;;) {
+        skip_trivia(b);
+        if (at_end(b) || b->failed) break;
+        if (tok_char(b, b->pos) == '}') {
+            b->pos++;
+            break;
+        }
+        if (tok_char(b, b->pos) == ';') {
+            b->pos++;
+            continue;
+        }
+
+        size_t before = b->pos;
+        parse_member(b);
+        if (b->pos == before) b->pos++;
+    }
+
+    finish_children(b, mark, klass);
+    klass->end_token = (uint32_t)b->pos;
+}
+
+// Declarations that may follow export; returns 1 if one was parsed
+static int parse_declaration(TreeBuilder *b, uint8_t flags) {
+    const char *text;
+    size_t length;
+    size_t start = b->pos;
+    size_t after = read_word(b, start, &text, &length);
+    size_t mark = b->scratch_count;
+    Node node;
+
+    if (b->tokens[start].type == TOKEN_INTERFACE) {
+        node = make_node(NODE_INTERFACE, start);
+        set_name(b, &node, after);
+        scan_rest(b, &node, mark, SCAN_STATEMENT);
+    } else if (b->tokens[start].type == TOKEN_TYPE) {
+        node = make_node(NODE_TYPE_ALIAS, start);
+        set_name(b, &node, after);
+        scan_rest(b, &node, mark, SCAN_STATEMENT);
+    } else if (word_eq(text, length, "function") ||
+               (word_eq(text, length, "async") && next_word_is(b, after, "function"))) {
+        node = make_node(NODE_FUNCTION, start);
+        if (word_eq(text, length, "async")) {
+            after = read_word(b, next_significant(b, after), &text, &length);
+        }
+        size_t name = next_significant(b, after);
+        if (tok_char(b, name) == '*') name++;
+        b->pos = name;
+        set_name(b, &node, name);
+        scan_rest(b, &node, mark, SCAN_FUNCTION);
+    } else if (word_eq(text, length, "class") ||
+               (word_eq(text, length, "abstract") && next_word_is(b, after, "class"))) {
+        node = make_node(NODE_CLASS, start);
+        if (word_eq(text, length, "abstract")) {
+            after = read_word(b, next_significant(b, after), &text, &length);
+        }
+        b->pos = after;
+        if (!next_word_is(b, after, "extends") && !next_word_is(b, after, "implements")) {
+            set_name(b, &node, after);
+        }
+        parse_class_body(b, &node, mark);
+    } else if (word_eq(text, length, "const") || word_eq(text, length, "let") ||
+               word_eq(text, length, "var")) {
+        node = make_node(NODE_VARIABLE, start);
+        b->pos = after;
+        set_name(b, &node, after);
+        scan_rest(b, &node, mark, SCAN_STATEMENT);
+    } else {
+        return 0;
+    }
+
+    node.flags |= flags;
+    push_node(b, &node);
+    return 1;
+}
+
+static void parse_export(TreeBuilder *b) {
+    Node node = make_node(NODE_EXPORT, b->pos);
+    size_t mark = b->scratch_count;
+
+    const char *text;
+    size_t length;
+    b->pos = read_word(b, b->pos, &text, &length);
+    skip_trivia(b);
+
+    size_t after = read_word(b, b->pos, &text, &length);
+    if (word_eq(text, length, "default")) {
+        node.flags |= NODE_FLAG_DEFAULT;
+        b->pos = after;
+        skip_trivia(b);
+    }
+
+    // export type { A } is a type-only list, export type A = ... a declaration
+    if (b->tokens[b->pos].type == TOKEN_TYPE) {
+        char follow = tok_char(b, next_significant(b, b->pos + 1));
+        if (follow == '{' || follow == '*') {
+            node.flags |= NODE_FLAG_TYPE_ONLY;
+            b->pos++;
+        }
+    }
+
+    uint8_t child_flags = NODE_FLAG_EXPORTED | (node.flags & NODE_FLAG_DEFAULT);
+    if (!(node.flags & NODE_FLAG_TYPE_ONLY) && parse_declaration(b, child_flags)) {
+        finish_children(b, mark, &node);
+        node.end_token = (uint32_t)b->pos;
+    } else {
+        scan_rest(b, &node, mark, SCAN_STATEMENT);
+    }
+    push_node(b, &node);
+}
+
+static void parse_statement(TreeBuilder *b) {
+    char c = tok_char(b, b->pos);
+    if (c == '{') {
+        parse_block(b);
+        return;
+    }
+
+    const char *text;
+    size_t length;
+    size_t after = read_word(b, b->pos, &text, &length);
+
+    if (word_eq(text, length, "export")) {
+        parse_export(b);
+        return;
+    }
+
+    if (parse_declaration(b, 0)) {
+        return;
+    }
+
+    // import(...) and import.meta are expressions
+    size_t next = next_significant(b, after);
+    int is_import = word_eq(text, length, "import") && tok_char(b, next) != '(' && tok_char(b, next) != '.';
+
+    Node node = make_node(is_import ? NODE_IMPORT : NODE_STATEMENT, b->pos);
+    if (is_import && b->tokens[next].type == TOKEN_TYPE) {
+        // "import type from" imports a binding named type
+        size_t follow = next_significant(b, next + 1);
+        if (tok_char(b, follow) != ',' && !next_word_is(b, follow, "from")) {
+            node.flags |= NODE_FLAG_TYPE_ONLY;
+        }
+    }
+    scan_rest(b, &node, b->scratch_count, SCAN_STATEMENT);
+    push_node(b, &node);
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+SyntaxTree* tree_build(const AST *ast, const char *source) {
+    if (!ast || !source) return NULL;
+
+    // Roughly one node per eight tokens keeps most files in a single chunk
+    uint32_t capacity = (uint32_t)(ast->count / 8) + 16;
+    Arena arena;
+    arena_init(&arena, sizeof(SyntaxTree) + capacity * sizeof(Node) + 64);
+
+    SyntaxTree *tree = arena_alloc(&arena, sizeof(SyntaxTree));
+    if (!tree) {
+        arena_free(&arena);
+        return NULL;
+    }
+    tree->arena = arena;
+    tree->ast = ast;
+    tree->source = source;
+    tree->count = 0;
+    tree->root = NODE_NONE;
+    tree->nodes = arena_alloc(&tree->arena, capacity * sizeof(Node));
+
+    TreeBuilder b;
+    memset(&b, 0, sizeof(b));
+    b.tree = tree;
+    b.tokens = ast->tokens;
+    b.token_count = ast->count;
+    b.capacity = capacity;
+    b.failed = tree->nodes == NULL;
+
+    Node program = make_node(NODE_PROGRAM, 0);
+    while (!b.failed && !at_end(&b)) {
+        parse_statements(&b);
+        if (!at_end(&b)) b.pos++;  // Stray } at top level
+    }
+    finish_children(&b, 0, &program);
+    program.end_token = (uint32_t)ast->count;
+
+    // The root goes in last, after all of its descendants
+    Node holder = make_node(NODE_PROGRAM, 0);
+    push_node(&b, &program);
+    finish_children(&b, 0, &holder);
+    tree->root = holder.first_child;
+    free(b.scratch);
+
+    if (b.failed) {
+        tree_free(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+void tree_free(SyntaxTree *tree) {
+    if (tree) {
+        Arena arena = tree->arena;
+        arena_free(&arena);
+    }
+}
+
+const char* node_kind_name(NodeKind kind) {
+    switch (kind) {
+        case NODE_PROGRAM:    return "Program";
+        case NODE_IMPORT:     return "Import";
+        case NODE_EXPORT:     return "Export";
+        case NODE_INTERFACE:  return "Interface";
+        case NODE_TYPE_ALIAS: return "TypeAlias";
+        case NODE_FUNCTION:   return "Function";
+        case NODE_CLASS:      return "Class";
+        case NODE_MEMBER:     return "Member";
+        case NODE_VARIABLE:   return "Variable";
+        case NODE_BLOCK:      return "Block";
+        case NODE_STATEMENT:  return "Statement";
+    }
+    return "Unknown";
+}
+
+// Token helpers only look at the token array
+static TreeBuilder token_reader(const SyntaxTree *tree) {
+    TreeBuilder b;
+    memset(&b, 0, sizeof(b));
+    b.tokens = tree->ast->tokens;
+    b.token_count = tree->ast->count;
+    return b;
+}
+
+size_t tree_next_significant(const SyntaxTree *tree, size_t token) {
+    TreeBuilder b = token_reader(tree);
+    return next_significant(&b, token);
+}
+
+size_t tree_read_word(const SyntaxTree *tree, size_t token, const char **text, size_t *length) {
+    TreeBuilder b = token_reader(tree);
+    return read_word(&b, token, text, length);
+}
+
+static void dump_node(const SyntaxTree *tree, uint32_t index, int depth, FILE *file) {
+    const Node *node = &tree->nodes[index];
+    const Token *first = &tree->ast->tokens[node->first_token < tree->ast->count ? node->first_token : tree->ast->count - 1];
+
+    fprintf(file, "%*s%s", depth * 2, "", node_kind_name((NodeKind)node->kind));
+    if (node->name_offset != NODE_NONE) {
+        fprintf(file, " %.*s", (int)node->name_length, tree->source + node->name_offset);
+    }
+    if (node->flags & NODE_FLAG_DEFAULT) fprintf(file, " [default]");
+    if (node->flags & NODE_FLAG_TYPE_ONLY) fprintf(file, " [type]");
+    fprintf(file, " (line %d)\n", first->line);
+}
+
+// Pending node on the dump stack
+typedef struct {
+    uint32_t index;
+    int depth;
+} DumpEntry;
+
+void tree_dump(const SyntaxTree *tree, FILE *file) {
+    if (!tree || tree->root == NODE_NONE) return;
+
+    // Preorder walk with an explicit stack; children are pushed last first
+    size_t capacity = 64;
+    size_t count = 0;
+    DumpEntry *stack = malloc(capacity * sizeof(DumpEntry));
+    if (!stack) return;
+    stack[count++] = (DumpEntry){tree->root, 0};
+
+    while (count) {
+        DumpEntry entry = stack[--count];
+        const Node *node = &tree->nodes[entry.index];
+        dump_node(tree, entry.index, entry.depth, file);
+
+        if (count + node->child_count > capacity) {
+            while (count + node->child_count > capacity) capacity *= 2;
+            DumpEntry *grown = realloc(stack, capacity * sizeof(DumpEntry));
+            if (!grown) break;
+            stack = grown;
+        }
+        for (uint32_t i = node->child_count; i > 0; i--) {
+            stack[count++] = (DumpEntry){node->first_child + i - 1, entry.depth + 1};
+        }
+    }
+    free(stack);
+}
@@ -0,0 +1,76 @@
+#ifndef TREE_H
+#define TREE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "analyzer.h"
+#include "arena.h"
+
+#define NODE_NONE UINT32_MAX
+
+// Blocks nested deeper than this become childless NODE_BLOCKs, which keeps
+// the recursive builder's stack use bounded on hostile input
+#define TREE_MAX_DEPTH 256
+
+// Declaration and statement kinds
+typedef enum {
+    NODE_PROGRAM,            // Whole file; children are top-level statements
+    NODE_IMPORT,             // import declaration
+    NODE_EXPORT,             // export statement; child is the exported declaration if any
+    NODE_INTERFACE,          // interface declaration
+    NODE_TYPE_ALIAS,         // type X = ...
+    NODE_FUNCTION,           // function declaration; child is the body block
+    NODE_CLASS,              // class declaration; children are members
+    NODE_MEMBER,             // class member; child is the method body if any
+    NODE_VARIABLE,           // const/let/var declaration
+    NODE_BLOCK,              // { ... }; children are statements
+    NODE_STATEMENT           // Any other statement
+} NodeKind;
+
+// Node flags
+#define NODE_FLAG_EXPORTED   0x01  // Declaration is the child of an export
+#define NODE_FLAG_DEFAULT    0x02  // export default
+#define NODE_FLAG_TYPE_ONLY  0x04  // export type { ... } / import type ...
+
+// Syntax tree node; children of a node are contiguous in SyntaxTree.nodes
+typedef struct {
+    uint8_t kind;            // NodeKind
+    uint8_t flags;
+    uint32_t first_token;    // Index of the first token
+    uint32_t end_token;      // Index one past the last token
+    uint32_t name_offset;    // Byte offset of the declared name (NODE_NONE if unnamed)
+    uint32_t name_length;
+    uint32_t first_child;    // Index of the first child node
+    uint32_t child_count;
+} Node;
+
+// Tree over an AST; all nodes live in one arena
+typedef struct {
+    const AST *ast;
+    const char *source;
+    Node *nodes;
+    uint32_t count;
+    uint32_t root;           // Index of the NODE_PROGRAM node
+    Arena arena;
+} SyntaxTree;
+
+// Build the declaration/statement tree for a lexed file
+SyntaxTree* tree_build(const AST *ast, const char *source);
+
+// Free the tree (the AST and source are not owned)
+void tree_free(SyntaxTree *tree);
+
+// Name of a node kind
+const char* node_kind_name(NodeKind kind);
+
+// Print the tree as an indented outline
+void tree_dump(const SyntaxTree *tree, FILE *file);
+
+// Index of the first token at or after token that is not whitespace or a comment
+size_t tree_next_significant(const SyntaxTree *tree, size_t token);
+
+// Identifier or keyword starting at token; returns the token index after it
+// (token itself, with *text NULL, if there is no word there)
+size_t tree_read_word(const SyntaxTree *tree, size_t token, const char **text, size_t *length);
+
+#endif // TREE_H
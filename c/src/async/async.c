@@ -0,0 +1,225 @@
+#define _GNU_SOURCE
+
+#include "async.h"
+#include "../pool/pool.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+// One submitted job; it becomes a completion in place when it finishes
+typedef struct StripJob {
+    StripQueue *queue;
+    const char *source;
+    size_t size;
+    StripJobOptions options;
+    StripCompletion result;
+    struct StripJob *next;       // Completion list link
+} StripJob;
+
+struct StripQueue {
+    ThreadPool *pool;
+    pthread_mutex_t lock;
+    pthread_cond_t done;
+    StripJob *head;              // Finished jobs, oldest first
+    StripJob *tail;
+    size_t pending;              // Submitted and not yet collected
+    int fd;                      // eventfd, -1 without one
+};
+
+// The eventfd counter is nonzero exactly while the list is non-empty: the
+// first completion raises it and collecting the last one clears it
+// (caller holds the lock)
+static void signal_ready(StripQueue *queue) {
+#ifdef __linux__
+    if (queue->fd >= 0) {
+        uint64_t one = 1;
+        while (write(queue->fd, &one, sizeof(one)) < 0 && errno == EINTR) {}
+    }
+#else
+    (void)queue;
+#endif
+}
+
+static void clear_ready(StripQueue *queue) {
+#ifdef __linux__
+    if (queue->fd >= 0) {
+        uint64_t count;
+        while (read(queue->fd, &count, sizeof(count)) < 0 && errno == EINTR) {}
+    }
+#else
+    (void)queue;
+#endif
+}
+
+static void strip_job(void *arg) {
+    StripJob *job = arg;
+    StripCompletion *result = &job->result;
+
+    AST *ast = engine_lex(job->options.engine, job->source, job->size);
+    if (ast) {
+        result->output = engine_parse(job->options.engine, ast, job->source);
+    } else if (job->size == 0) {
+        result->output = calloc(1, 1);  // Empty input, empty output
+    }
+
+    if (result->output) {
+        result->output_size = strlen(result->output);
+        if (job->options.deps && ast) {
+            // Hand the dependency array over to the completion
+            result->deps = ast->deps;
+            result->dep_count = ast->dep_count;
+            ast->deps = NULL;
+        }
+    } else {
+        result->status = -1;
+    }
+    ast_free(ast);
+
+    StripQueue *queue = job->queue;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->tail) {
+        queue->tail->next = job;
+    } else {
+        queue->head = job;
+        signal_ready(queue);
+    }
+    queue->tail = job;
+    pthread_cond_broadcast(&queue->done);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+StripQueue* strip_queue_create(int workers) {
+    StripQueue *queue = calloc(1, sizeof(StripQueue));
+    if (!queue) return NULL;
+
+    queue->fd = -1;
+#ifdef __linux__
+    queue->fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+#endif
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->done, &attr);
+    pthread_condattr_destroy(&attr);
+
+    queue->pool = pool_create(workers > 0 ? workers : pool_default_workers());
+    if (!queue->pool) {
+        strip_queue_destroy(queue);
+        return NULL;
+    }
+    return queue;
+}
+
+int strip_queue_submit(StripQueue *queue, const char *source, size_t size,
+                       const StripJobOptions *options, void *tag) {
+    if (!queue || (!source && size > 0)) return -1;
+
+    StripJob *job = calloc(1, sizeof(StripJob));
+    if (!job) return -1;
+    job->queue = queue;
+    job->source = source;
+    job->size = size;
+    if (options) job->options = *options;
+    job->result.tag = tag;
+
+    pthread_mutex_lock(&queue->lock);
+    queue->pending++;
+    pthread_mutex_unlock(&queue->lock);
+
+    if (pool_submit(queue->pool, strip_job, job) != 0) {
+        pthread_mutex_lock(&queue->lock);
+        queue->pending--;
+        pthread_mutex_unlock(&queue->lock);
+        free(job);
+        return -1;
+    }
+    return 0;
+}
+
+// Move finished jobs into out (caller holds the lock)
+static size_t collect(StripQueue *queue, StripCompletion *out, size_t max) {
+    size_t count = 0;
+    while (count < max && queue->head) {
+        StripJob *job = queue->head;
+        queue->head = job->next;
+        out[count++] = job->result;
+        free(job);
+    }
+    if (!queue->head) {
+        queue->tail = NULL;
+        if (count > 0) clear_ready(queue);
+    }
+    queue->pending -= count;
+    return count;
+}
+
+size_t strip_queue_poll(StripQueue *queue, StripCompletion *out, size_t max) {
+    pthread_mutex_lock(&queue->lock);
+    size_t count = collect(queue, out, max);
+    pthread_mutex_unlock(&queue->lock);
+    return count;
+}
+
+size_t strip_queue_wait(StripQueue *queue, StripCompletion *out, size_t max, int timeout_ms) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    if (timeout_ms > 0) {
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    pthread_mutex_lock(&queue->lock);
+    while (!queue->head && queue->pending > 0 && timeout_ms != 0) {
+        if (timeout_ms < 0) {
+            pthread_cond_wait(&queue->done, &queue->lock);
+        } else if (pthread_cond_timedwait(&queue->done, &queue->lock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    size_t count = collect(queue, out, max);
+    pthread_mutex_unlock(&queue->lock);
+    return count;
+}
+
+size_t strip_queue_pending(StripQueue *queue) {
+    pthread_mutex_lock(&queue->lock);
+    size_t pending = queue->pending;
+    pthread_mutex_unlock(&queue->lock);
+    return pending;
+}
+
+int strip_queue_fd(StripQueue *queue) {
+    return queue->fd;
+}
+
+void strip_queue_destroy(StripQueue *queue) {
+    if (!queue) return;
+
+    // Runs what is still queued, so every job ends up on the list
+    if (queue->pool) pool_destroy(queue->pool);
+
+    while (queue->head) {
+        StripJob *job = queue->head;
+        queue->head = job->next;
+        free(job->result.output);
+        free(job->result.deps);
+        free(job);
+    }
+    if (queue->fd >= 0) close(queue->fd);
+    pthread_cond_destroy(&queue->done);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue);
+}
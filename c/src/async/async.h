@@ -0,0 +1,58 @@
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include <stddef.h>
+#include "../analyzer/analyzer.h"
+#include "../analyzer/engine.h"
+
+// Asynchronous stripping for event-loop hosts: jobs are submitted without
+// blocking, run on an internal worker pool and are collected from a
+// completion queue, by polling or through a file descriptor that is
+// readable while completions are waiting (for epoll/poll/select).
+
+typedef struct StripQueue StripQueue;
+
+// Per-job options; a zeroed struct (or NULL) strips with the reference
+// engine and collects no dependencies
+typedef struct {
+    Engine engine;
+    int deps;                // Also collect module dependencies
+} StripJobOptions;
+
+// A finished job
+typedef struct {
+    void *tag;               // As given to strip_queue_submit()
+    int status;              // 0, or -1 when stripping failed
+    char *output;            // NUL-terminated, malloc'd (caller frees); NULL on failure
+    size_t output_size;
+    ModuleDep *deps;         // With options.deps (caller frees); specifiers point into the source
+    size_t dep_count;
+} StripCompletion;
+
+// Start a queue with its own pool (workers <= 0: one per usable CPU)
+StripQueue* strip_queue_create(int workers);
+
+// Queue source[0, size) for stripping; the source must stay valid and
+// unchanged until its completion is collected. Never waits for a worker.
+// Returns -1 when the job could not be queued.
+int strip_queue_submit(StripQueue *queue, const char *source, size_t size,
+                       const StripJobOptions *options, void *tag);
+
+// Move up to max finished jobs into out, oldest first, without waiting
+size_t strip_queue_poll(StripQueue *queue, StripCompletion *out, size_t max);
+
+// strip_queue_poll() that first waits up to timeout_ms (-1: no limit) for
+// a completion; returns 0 at once when no job is outstanding
+size_t strip_queue_wait(StripQueue *queue, StripCompletion *out, size_t max, int timeout_ms);
+
+// Jobs submitted and not yet collected
+size_t strip_queue_pending(StripQueue *queue);
+
+// eventfd that is readable exactly while completions are waiting (owned by
+// the queue; do not read it). -1 where eventfd is unavailable.
+int strip_queue_fd(StripQueue *queue);
+
+// Let outstanding jobs finish, drop uncollected completions and free the queue
+void strip_queue_destroy(StripQueue *queue);
+
+#endif // ASYNC_H
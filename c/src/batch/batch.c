@@ -0,0 +1,1008 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "batch.h"
+#include "../analyzer/analyzer.h"
+#include "../analyzer/exports.h"
+#include "../analyzer/engine.h"
+#include "../io/io.h"
+#include "../pool/pool.h"
+#include "../hash/hash.h"
+#include "../cache/cache.h"
+#include "isolate.h"
+#include "manifest.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+#endif
+
+// Stripped outputs kept in memory for duplicates; beyond this they are
+// re-read from the original's output file
+#define DEDUP_KEEP_BYTES (64u * 1024 * 1024)
+
+// Set of paths already queued (open addressing)
+typedef struct {
+    char **slots;
+    size_t capacity;
+    size_t count;
+} PathSet;
+
+typedef enum {
+    DEDUP_PENDING,           // Original still being stripped
+    DEDUP_DONE,
+    DEDUP_FAILED
+} DedupState;
+
+// Products of stripping one unique input, shared with its duplicates
+typedef struct {
+    unsigned char digest[SHA256_SIZE];
+    DedupState state;
+    char *result;            // Stripped output (NULL once over the keep budget)
+    size_t result_size;
+    MappedOutput mapped;     // Output file result points into (when is_mapped)
+    int is_mapped;
+    size_t input_size;
+    size_t tokens;           // Tokens lexed
+    char *output;            // Output path written for the original
+    unsigned char output_digest[SHA256_SIZE]; // Hash of result (hash_names, manifest)
+    int has_output_digest;
+    char **imports;          // Relative runtime import specifiers (crawl mode)
+    size_t import_count;
+    IndexModule exports;     // Export index template
+    int has_exports;
+    char **waiters;          // Duplicate paths that arrived while pending
+    size_t waiter_count;
+    size_t waiter_capacity;
+} DedupEntry;
+
+// Content digest -> entry (open addressing)
+typedef struct {
+    DedupEntry **slots;
+    size_t capacity;
+    size_t count;
+    size_t kept_bytes;       // Total size of results still held in memory
+} DedupTable;
+
+// State shared by all jobs of one batch run
+typedef struct {
+    const BatchOptions *options;
+    ThreadPool *pool;
+    IsolatePool *isolate;    // Worker processes (with options->isolate)
+    pthread_mutex_t lock;    // Guards seen, dedup, modules and stats
+    PathSet seen;
+    DedupTable dedup;
+    IndexModule *modules;    // Export index entries (with export_index)
+    size_t module_count;
+    size_t module_capacity;
+    ManifestEntry *manifest; // Outputs written (with options->manifest)
+    size_t manifest_count;
+    size_t manifest_capacity;
+    BatchStats stats;
+} BatchContext;
+
+typedef struct {
+    BatchContext *ctx;
+    char *path;
+} BatchJob;
+
+// Time since start, charged to stage when a summary is collected
+static void batch_stage(const BatchContext *ctx, SummaryStage stage, double start) {
+    if (ctx->options->summary) {
+        summary_add_stage(ctx->options->summary, stage, summary_now_ms() - start);
+    }
+}
+
+// ============================================================================
+// Paths
+// ============================================================================
+
+static uint64_t hash_string(const char *str) {
+    uint64_t hash = 14695981039346656037ULL;  // FNV-1a
+    for (; *str; str++) {
+        hash ^= (unsigned char)*str;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Insert path (taking ownership); returns 0 and frees it if already present
+static int path_set_insert(PathSet *set, char *path) {
+    if ((set->count + 1) * 2 > set->capacity) {
+        size_t capacity = set->capacity ? set->capacity * 2 : 64;
+        char **slots = calloc(capacity, sizeof(char*));
+        if (!slots) {
+            free(path);
+            return 0;
+        }
+        for (size_t i = 0; i < set->capacity; i++) {
+            if (!set->slots[i]) continue;
+            size_t j = hash_string(set->slots[i]) & (capacity - 1);
+            while (slots[j]) j = (j + 1) & (capacity - 1);
+            slots[j] = set->slots[i];
+        }
+        free(set->slots);
+        set->slots = slots;
+        set->capacity = capacity;
+    }
+
+    size_t i = hash_string(path) & (set->capacity - 1);
+    while (set->slots[i]) {
+        if (strcmp(set->slots[i], path) == 0) {
+            free(path);
+            return 0;
+        }
+        i = (i + 1) & (set->capacity - 1);
+    }
+    set->slots[i] = path;
+    set->count++;
+    return 1;
+}
+
+static void path_set_free(PathSet *set) {
+    for (size_t i = 0; i < set->capacity; i++) {
+        free(set->slots[i]);
+    }
+    free(set->slots);
+}
+
+// Collapse "." and ".." segments and duplicate slashes
+static char* normalize_path(const char *path, size_t length) {
+    char *out = malloc(length + 2);
+    if (!out) return NULL;
+
+    size_t n = 0;
+    size_t root = 0;
+    if (length > 0 && path[0] == '/') {
+        out[n++] = '/';
+        root = 1;
+    }
+
+    size_t i = 0;
+    while (i < length) {
+        size_t j = i;
+        while (j < length && path[j] != '/') j++;
+        size_t segment = j - i;
+
+        if (segment == 0 || (segment == 1 && path[i] == '.')) {
+            // Nothing to add
+        } else if (segment == 2 && path[i] == '.' && path[i + 1] == '.') {
+            size_t last = n;
+            while (last > root && out[last - 1] != '/') last--;
+            int last_is_up = n - last == 2 && out[last] == '.' && out[last + 1] == '.';
+            if (n > root && !last_is_up) {
+                n = last > root ? last - 1 : root;
+            } else if (!root) {
+                if (n > 0) out[n++] = '/';
+                out[n++] = '.';
+                out[n++] = '.';
+            }
+        } else {
+            if (n > root) out[n++] = '/';
+            memcpy(out + n, path + i, segment);
+            n += segment;
+        }
+        i = j + 1;
+    }
+
+    if (n == 0) out[n++] = '.';
+    out[n] = '\0';
+    return out;
+}
+
+static int has_suffix(const char *str, size_t length, const char *suffix) {
+    size_t suffix_length = strlen(suffix);
+    return length >= suffix_length && memcmp(str + length - suffix_length, suffix, suffix_length) == 0;
+}
+
+static int is_relative_specifier(const char *specifier, size_t length) {
+    return (length >= 1 && specifier[0] == '.') &&
+           (length == 1 || specifier[1] == '/' ||
+            (specifier[1] == '.' && (length == 2 || specifier[2] == '/')));
+}
+
+char* resolve_import(const char *importer, const char *specifier, size_t length) {
+    const char *slash = strrchr(importer, '/');
+    size_t dir_length = slash ? (size_t)(slash - importer) + 1 : 0;
+
+    char *joined = malloc(dir_length + length + 1);
+    if (!joined) return NULL;
+    memcpy(joined, importer, dir_length);
+    memcpy(joined + dir_length, specifier, length);
+    joined[dir_length + length] = '\0';
+
+    char *base = normalize_path(joined, dir_length + length);
+    free(joined);
+    if (!base) return NULL;
+
+    size_t base_length = strlen(base);
+    char *candidate = malloc(base_length + sizeof("/index.tsx"));
+    if (!candidate) {
+        free(base);
+        return NULL;
+    }
+
+    static const char *probes[] = { "", ".ts", ".tsx", "/index.ts", "/index.tsx" };
+    for (size_t i = 0; i < sizeof(probes) / sizeof(probes[0]); i++) {
+        if (i == 0 && !has_suffix(base, base_length, ".ts") && !has_suffix(base, base_length, ".tsx")) {
+            continue;
+        }
+        sprintf(candidate, "%s%s", base, probes[i]);
+        if (is_regular_file(candidate)) {
+            free(base);
+            return candidate;
+        }
+    }
+
+    // ESM-style "./x.js" specifiers that point at TypeScript sources
+    if (has_suffix(base, base_length, ".js")) {
+        base[base_length - 3] = '\0';
+        for (size_t i = 1; i <= 2; i++) {
+            sprintf(candidate, "%s%s", base, probes[i]);
+            if (is_regular_file(candidate)) {
+                free(base);
+                return candidate;
+            }
+        }
+    }
+
+    free(candidate);
+    free(base);
+    return NULL;
+}
+
+// Map an input path into the output directory; ".." and the leading "/" are
+// rewritten so the mirrored tree cannot escape output_dir
+static char* output_path(const BatchOptions *options, const char *path) {
+    if (!options->output_dir) {
+        return strdup(path);
+    }
+
+    size_t dir_length = strlen(options->output_dir);
+    char *out = malloc(dir_length + strlen(path) + 2);
+    if (!out) return NULL;
+
+    memcpy(out, options->output_dir, dir_length);
+    size_t n = dir_length;
+    while (*path == '/') path++;
+    while (*path) {
+        const char *end = strchr(path, '/');
+        size_t segment = end ? (size_t)(end - path) : strlen(path);
+        out[n++] = '/';
+        if (segment == 2 && path[0] == '.' && path[1] == '.') {
+            out[n++] = '_';
+            out[n++] = '_';
+        } else {
+            memcpy(out + n, path, segment);
+            n += segment;
+        }
+        path += segment;
+        while (*path == '/') path++;
+    }
+    out[n] = '\0';
+    return out;
+}
+
+// ============================================================================
+// Duplicate detection
+// ============================================================================
+
+static size_t digest_slot(const unsigned char *digest, size_t capacity) {
+    uint64_t prefix;
+    memcpy(&prefix, digest, sizeof(prefix));
+    return (size_t)prefix & (capacity - 1);
+}
+
+// Find the entry for digest, creating a pending one if it is new
+static DedupEntry* dedup_lookup(DedupTable *table, const unsigned char *digest, int *inserted) {
+    *inserted = 0;
+
+    if ((table->count + 1) * 2 > table->capacity) {
+        size_t capacity = table->capacity ? table->capacity * 2 : 64;
+        DedupEntry **slots = calloc(capacity, sizeof(DedupEntry*));
+        if (!slots) return NULL;
+        for (size_t i = 0; i < table->capacity; i++) {
+            if (!table->slots[i]) continue;
+            size_t j = digest_slot(table->slots[i]->digest, capacity);
+            while (slots[j]) j = (j + 1) & (capacity - 1);
+            slots[j] = table->slots[i];
+        }
+        free(table->slots);
+        table->slots = slots;
+        table->capacity = capacity;
+    }
+
+    size_t i = digest_slot(digest, table->capacity);
+    while (table->slots[i]) {
+        if (memcmp(table->slots[i]->digest, digest, SHA256_SIZE) == 0) {
+            return table->slots[i];
+        }
+        i = (i + 1) & (table->capacity - 1);
+    }
+
+    DedupEntry *entry = calloc(1, sizeof(DedupEntry));
+    if (!entry) return NULL;
+    memcpy(entry->digest, digest, SHA256_SIZE);
+    entry->state = DEDUP_PENDING;
+    table->slots[i] = entry;
+    table->count++;
+    *inserted = 1;
+    return entry;
+}
+
+static int dedup_add_waiter(DedupEntry *entry, char *path) {
+    if (entry->waiter_count >= entry->waiter_capacity) {
+        size_t capacity = entry->waiter_capacity ? entry->waiter_capacity * 2 : 4;
+        char **waiters = realloc(entry->waiters, capacity * sizeof(char*));
+        if (!waiters) return -1;
+        entry->waiters = waiters;
+        entry->waiter_capacity = capacity;
+    }
+    entry->waiters[entry->waiter_count++] = path;
+    return 0;
+}
+
+// Drop the stripped output, whether heap-allocated or mapped
+static void entry_drop_result(DedupEntry *entry) {
+    if (entry->is_mapped) {
+        mapped_output_abort(&entry->mapped);
+        entry->is_mapped = 0;
+    } else {
+        free(entry->result);
+    }
+    entry->result = NULL;
+}
+
+static void dedup_entry_clear(DedupEntry *entry) {
+    entry_drop_result(entry);
+    free(entry->output);
+    for (size_t i = 0; i < entry->import_count; i++) {
+        free(entry->imports[i]);
+    }
+    free(entry->imports);
+    if (entry->has_exports) {
+        index_module_free(&entry->exports);
+    }
+    free(entry->waiters);
+}
+
+static void dedup_free(DedupTable *table) {
+    for (size_t i = 0; i < table->capacity; i++) {
+        if (!table->slots[i]) continue;
+        dedup_entry_clear(table->slots[i]);
+        free(table->slots[i]);
+    }
+    free(table->slots);
+}
+
+// ============================================================================
+// Jobs
+// ============================================================================
+
+static void batch_job(void *arg);
+
+// Queue path (taking ownership) unless it was already seen
+static void batch_enqueue(BatchContext *ctx, char *path) {
+    pthread_mutex_lock(&ctx->lock);
+    int inserted = path_set_insert(&ctx->seen, path);
+    pthread_mutex_unlock(&ctx->lock);
+    if (!inserted) return;
+
+    // The set keeps its own copy for lookups
+    BatchJob *job = malloc(sizeof(BatchJob));
+    if (job) {
+        job->ctx = ctx;
+        job->path = strdup(path);
+    }
+    if (!job || !job->path || pool_submit(ctx->pool, batch_job, job) != 0) {
+        fprintf(stderr, "Error: Cannot queue '%s'\n", path);
+        if (job) free(job->path);
+        free(job);
+        pthread_mutex_lock(&ctx->lock);
+        ctx->stats.failed++;
+        pthread_mutex_unlock(&ctx->lock);
+    }
+}
+
+// Build the export index template for a stripped file
+static int collect_exports(const AST *ast, const char *code, IndexModule *exports) {
+    ExportList list = {NULL, 0, 0};
+    SyntaxTree *tree = NULL;
+
+    // Empty files have no AST and export nothing
+    if (ast) {
+        tree = tree_build(ast, code);
+        if (!tree || exports_collect(tree, &list) != 0) {
+            tree_free(tree);
+            return -1;
+        }
+    }
+
+    int status = index_module_init(exports, "", &list);
+    exports_free(&list);
+    tree_free(tree);
+    return status;
+}
+
+// Keep the relative runtime imports to crawl
+// Type-only imports vanish from the output, so they are not followed
+static void collect_imports(DedupEntry *entry, const ModuleDep *deps, size_t count) {
+    entry->imports = malloc((count ? count : 1) * sizeof(char*));
+    for (size_t i = 0; entry->imports && i < count; i++) {
+        const ModuleDep *dep = &deps[i];
+        if (dep->type_only || !is_relative_specifier(dep->specifier, dep->length)) continue;
+        char *specifier = strndup(dep->specifier, dep->length);
+        if (specifier) entry->imports[entry->import_count++] = specifier;
+    }
+}
+
+// Add a module to the combined index, copying the template under path
+static int batch_add_exports(BatchContext *ctx, const char *path, const IndexModule *exports) {
+    ExportList view = {exports->symbols, exports->count, exports->count};
+    IndexModule module;
+    if (index_module_init(&module, path, &view) != 0) return -1;
+
+    pthread_mutex_lock(&ctx->lock);
+    if (ctx->module_count >= ctx->module_capacity) {
+        size_t capacity = ctx->module_capacity ? ctx->module_capacity * 2 : 64;
+        IndexModule *modules = realloc(ctx->modules, capacity * sizeof(IndexModule));
+        if (!modules) {
+            pthread_mutex_unlock(&ctx->lock);
+            index_module_free(&module);
+            return -1;
+        }
+        ctx->modules = modules;
+        ctx->module_capacity = capacity;
+    }
+    ctx->modules[ctx->module_count++] = module;
+    pthread_mutex_unlock(&ctx->lock);
+    return 0;
+}
+
+// Find the plan for digest: the local cache answers at once, otherwise a
+// remote lookup is started and *lookup set (finish it with cache_wait())
+// Plans carry no exports, so runs that index exports always strip
+static int cache_find(BatchContext *ctx, const unsigned char *digest, size_t size,
+                      EditPlan *plan, RemoteRequest **lookup) {
+    *lookup = NULL;
+    if (ctx->options->export_index) return -1;
+
+    if (ctx->options->cache_dir && plan_load(ctx->options->cache_dir, digest, plan) == 0) return 0;
+    if (ctx->options->remote) *lookup = remote_lookup(ctx->options->remote, digest, size);
+    return -1;
+}
+
+// Wait for a remote lookup; a plan that arrives is kept locally too
+static int cache_wait(BatchContext *ctx, const unsigned char *digest, RemoteRequest *lookup,
+                      EditPlan *plan) {
+    if (remote_lookup_finish(ctx->options->remote, lookup, plan) != 0) return -1;
+    if (ctx->options->cache_dir) plan_store(ctx->options->cache_dir, digest, plan);
+    return 0;
+}
+
+// Rebuild entry from a cached edit plan; returns 0 on success
+static int cache_apply(BatchContext *ctx, const EditPlan *plan, const char *code, size_t size,
+                       DedupEntry *entry) {
+    if (entry->is_mapped) {
+        if (plan->output_size >= entry->mapped.capacity ||
+            plan_apply_into(plan, code, size, entry->mapped.data) == SIZE_MAX) {
+            return -1;
+        }
+        entry->result = entry->mapped.data;
+    } else {
+        entry->result = plan_apply(plan, code, size);
+        if (!entry->result) return -1;
+    }
+    entry->result_size = plan->output_size;
+    entry->input_size = size;
+    entry->tokens = plan->token_count;
+
+    if (ctx->options->crawl) {
+        ModuleDep *deps = malloc((plan->dep_count ? plan->dep_count : 1) * sizeof(ModuleDep));
+        if (deps) {
+            plan_module_deps(plan, code, deps);
+            collect_imports(entry, deps, plan->dep_count);
+        }
+        free(deps);
+    }
+    return 0;
+}
+
+// Store the edit plan for a freshly stripped entry (best effort)
+static void cache_keep(BatchContext *ctx, const unsigned char *digest, const char *code, size_t size,
+                       const DedupEntry *entry, const ModuleDep *deps, size_t dep_count) {
+    EditPlan plan;
+    if (plan_build(code, size, entry->result, entry->result_size, &plan) != 0) return;
+    plan.token_count = entry->tokens;
+    if (plan_set_deps(&plan, code, deps, dep_count) == 0) {
+        if (ctx->options->cache_dir) plan_store(ctx->options->cache_dir, digest, &plan);
+        if (ctx->options->remote) remote_store(ctx->options->remote, digest, &plan);
+    }
+    plan_free(&plan);
+}
+
+// Strip in a worker process; a crash fails only this file
+static int strip_isolated(BatchContext *ctx, const char *path, const char *code, size_t size,
+                          const unsigned char *digest, DedupEntry *entry) {
+    IsolateResult result;
+    int want_exports = ctx->options->export_index != NULL;
+    double start = summary_now_ms();
+    int status = isolate_strip(ctx->isolate, code, size, want_exports, &result);
+    batch_stage(ctx, STAGE_STRIP, start);
+
+    if (status == ISOLATE_CRASHED) {
+        fprintf(stderr, "Error: Worker process died (%s) while stripping '%s'\n",
+                result.term_signal ? strsignal(result.term_signal) : "exited", path);
+        return -1;
+    }
+    if (status != ISOLATE_OK) {
+        fprintf(stderr, "Error: Type stripping failed for '%s'\n", path);
+        return -1;
+    }
+
+    entry->result = result.output;
+    entry->result_size = result.output_size;
+    entry->input_size = size;
+    entry->tokens = result.token_count;
+    result.output = NULL;
+
+    if (want_exports) {
+        if (index_module_init(&entry->exports, "", &result.exports) == 0) {
+            entry->has_exports = 1;
+        } else {
+            status = -1;
+        }
+    }
+    if (ctx->options->crawl && status == 0) {
+        collect_imports(entry, result.deps, result.dep_count);
+    }
+    if (digest && status == 0) {
+        cache_keep(ctx, digest, code, size, entry, result.deps, result.dep_count);
+    }
+
+    isolate_result_free(&result);
+    if (status != 0) {
+        entry_drop_result(entry);
+    }
+    return status;
+}
+
+// Large outputs are stripped straight into a mapped temporary file beside
+// their destination, sized from the input (no rule lengthens the text) and
+// renamed into place by finish_file()
+static void map_output(BatchContext *ctx, const char *path, size_t size, DedupEntry *entry) {
+    if (size < MAPPED_OUTPUT_MIN) return;
+
+    const BatchOptions *options = ctx->options;
+    char *out = output_path(options, path);
+    if (out && (!options->output_dir || make_parent_dirs(out) == 0) &&
+        mapped_output_open(&entry->mapped, out, size + 1) == 0) {
+        entry->is_mapped = 1;
+    }
+    free(out);
+}
+
+// Strip code into entry: output, runtime relative imports and exports
+// With a digest the edit-plan cache is consulted first and filled on a miss
+static int strip_into(BatchContext *ctx, const char *path, const char *code, size_t size,
+                      const unsigned char *digest, DedupEntry *entry) {
+    // A remote lookup runs while the output file is being mapped
+    EditPlan plan;
+    RemoteRequest *lookup = NULL;
+    int found = digest && cache_find(ctx, digest, size, &plan, &lookup) == 0;
+    if (!ctx->isolate) {
+        map_output(ctx, path, size, entry);
+    }
+    if (lookup) {
+        found = cache_wait(ctx, digest, lookup, &plan) == 0;
+    }
+    if (digest) {
+        int hit = found && cache_apply(ctx, &plan, code, size, entry) == 0;
+        if (found) plan_free(&plan);
+        pthread_mutex_lock(&ctx->lock);
+        if (hit) ctx->stats.cache_hits++; else ctx->stats.cache_misses++;
+        pthread_mutex_unlock(&ctx->lock);
+        if (hit) return 0;
+    }
+    if (ctx->isolate) {
+        return strip_isolated(ctx, path, code, size, digest, entry);
+    }
+
+    AST *ast = NULL;
+
+    // One lex feeds stripping, import discovery and the export index
+    double start = summary_now_ms();
+    if (entry->is_mapped) {
+        size_t length = engine_strip_into(code, size, entry->mapped.data, &ast);
+        if (length != SIZE_MAX) {
+            entry->result = entry->mapped.data;
+            entry->result_size = length;
+        }
+    } else if (size == 0) {
+        entry->result = strdup("");
+    } else {
+        entry->result = engine_strip(code, size, &ast);
+    }
+    remote_note_strip(ctx->options->remote, size, summary_now_ms() - start);
+    batch_stage(ctx, STAGE_STRIP, start);
+    if (!entry->result) {
+        fprintf(stderr, "Error: Type stripping failed for '%s'\n", path);
+        ast_free(ast);
+        entry_drop_result(entry);
+        return -1;
+    }
+    if (!entry->is_mapped) entry->result_size = strlen(entry->result);
+    entry->input_size = size;
+    entry->tokens = ast ? ast->count : 0;
+
+    int status = 0;
+    if (ctx->options->export_index) {
+        start = summary_now_ms();
+        int collected = collect_exports(ast, code, &entry->exports) == 0;
+        batch_stage(ctx, STAGE_INDEX, start);
+        if (collected) {
+            entry->has_exports = 1;
+        } else {
+            fprintf(stderr, "Error: Cannot index exports of '%s'\n", path);
+            status = -1;
+        }
+    }
+
+    if (ctx->options->crawl && ast && status == 0) {
+        collect_imports(entry, ast->deps, ast->dep_count);
+    }
+    if (digest && status == 0) {
+        cache_keep(ctx, digest, code, size, entry, ast ? ast->deps : NULL, ast ? ast->dep_count : 0);
+    }
+
+    ast_free(ast);
+    if (status != 0) {
+        entry_drop_result(entry);
+    }
+    return status;
+}
+
+// Produce a duplicate's output from the original by link, reflink or copy
+static int write_duplicate(BatchContext *ctx, const DedupEntry *entry, const char *out) {
+    DedupMode mode = ctx->options->dedup;
+
+    if (mode == DEDUP_LINK && entry->output) {
+        if ((unlink(out) == 0 || errno == ENOENT) && link(entry->output, out) == 0) return 0;
+    }
+
+#ifdef FICLONE
+    if (mode == DEDUP_REFLINK && entry->output) {
+        int src = open(entry->output, O_RDONLY);
+        int dst = src >= 0 ? open(out, O_WRONLY | O_CREAT | O_TRUNC, 0644) : -1;
+        int cloned = dst >= 0 && ioctl(dst, FICLONE, src) == 0;
+        if (src >= 0) close(src);
+        if (dst >= 0) close(dst);
+        if (cloned) return 0;
+    }
+#endif
+
+    if (entry->result) {
+        return write_output(out, entry->result);
+    }
+
+    // Buffer was dropped to bound memory; copy the original's output file
+    size_t size = 0;
+    char *content = entry->output ? read_file(entry->output, &size) : NULL;
+    int status = content ? write_output(out, content) : -1;
+    free(content);
+    return status;
+}
+
+static int batch_add_manifest(BatchContext *ctx, const char *path, const char *out,
+                              const unsigned char *digest) {
+    ManifestEntry entry;
+    entry.source = strdup(path);
+    entry.output = strdup(out);
+    memcpy(entry.digest, digest, SHA256_SIZE);
+    if (!entry.source || !entry.output) {
+        free(entry.source);
+        free(entry.output);
+        return -1;
+    }
+
+    pthread_mutex_lock(&ctx->lock);
+    if (ctx->manifest_count >= ctx->manifest_capacity) {
+        size_t capacity = ctx->manifest_capacity ? ctx->manifest_capacity * 2 : 64;
+        ManifestEntry *entries = realloc(ctx->manifest, capacity * sizeof(ManifestEntry));
+        if (!entries) {
+            pthread_mutex_unlock(&ctx->lock);
+            free(entry.source);
+            free(entry.output);
+            return -1;
+        }
+        ctx->manifest = entries;
+        ctx->manifest_capacity = capacity;
+    }
+    ctx->manifest[ctx->manifest_count++] = entry;
+    pthread_mutex_unlock(&ctx->lock);
+    return 0;
+}
+
+// Emit outputs, follow imports and index exports for one path
+static int finish_file(BatchContext *ctx, const char *path, DedupEntry *entry, int duplicate) {
+    for (size_t i = 0; i < entry->import_count; i++) {
+        char *next = resolve_import(path, entry->imports[i], strlen(entry->imports[i]));
+        if (next) {
+            batch_enqueue(ctx, next);
+        } else {
+            pthread_mutex_lock(&ctx->lock);
+            ctx->stats.unresolved++;
+            pthread_mutex_unlock(&ctx->lock);
+        }
+    }
+
+    if (entry->has_exports && batch_add_exports(ctx, path, &entry->exports) != 0) {
+        fprintf(stderr, "Error: Cannot index exports of '%s'\n", path);
+        return -1;
+    }
+
+    // Hash the result in memory before it is written; duplicates share the original's
+    const BatchOptions *options = ctx->options;
+    if ((options->hash_names || options->manifest) && !entry->has_output_digest) {
+        sha256(entry->result, entry->result_size, entry->output_digest);
+        entry->has_output_digest = 1;
+    }
+
+    char *out = output_path(options, path);
+    if (out && options->hash_names) {
+        char *hashed = manifest_hashed_name(out, entry->output_digest);
+        free(out);
+        out = hashed;
+    }
+    int ok;
+    if (entry->is_mapped && !duplicate) {
+        // Publishing unmaps the output; duplicates then copy the file
+        ok = out && mapped_output_commit(&entry->mapped, entry->result_size, out) == 0;
+        if (!out) mapped_output_abort(&entry->mapped);
+        entry->is_mapped = 0;
+        entry->result = NULL;
+    } else {
+        ok = out && (!options->output_dir || make_parent_dirs(out) == 0) &&
+             (duplicate ? write_duplicate(ctx, entry, out) : write_output(out, entry->result)) == 0;
+    }
+    if (ok && options->manifest && batch_add_manifest(ctx, path, out, entry->output_digest) != 0) {
+        fprintf(stderr, "Error: Cannot record '%s' in the manifest\n", path);
+        ok = 0;
+    }
+
+    // Later duplicates link or clone this file
+    if (ok && !duplicate) {
+        entry->output = out;
+        out = NULL;
+    }
+    free(out);
+    return ok ? 0 : -1;
+}
+
+static void record_file(BatchContext *ctx, const DedupEntry *entry, int ok, int duplicate) {
+    pthread_mutex_lock(&ctx->lock);
+    ctx->stats.files++;
+    if (ok) {
+        ctx->stats.bytes_in += entry->input_size;
+        ctx->stats.bytes_out += entry->result_size;
+        if (duplicate) ctx->stats.duplicates++;
+    } else {
+        ctx->stats.failed++;
+    }
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+static void batch_job(void *arg) {
+    BatchJob *job = arg;
+    BatchContext *ctx = job->ctx;
+    char *path = job->path;
+    free(job);
+
+    size_t size = 0;
+    double start = summary_now_ms();
+    char *code = read_file(path, &size);
+    InputScan scan;
+    int valid = code && input_check(path, code, size, ctx->options->bom, &scan) == 0;
+    batch_stage(ctx, STAGE_READ, start);
+    if (!valid) {
+        free(code);
+        record_file(ctx, NULL, 0, 0);
+        free(path);
+        return;
+    }
+
+    // From here on the input starts after a dropped BOM
+    const char *text = code + scan.skip;
+    size -= scan.skip;
+
+    // The content digest keys both duplicate detection and the plan cache
+    unsigned char digest[SHA256_SIZE];
+    int cached = ctx->options->cache_dir || ctx->options->remote;
+    if (ctx->options->dedup != DEDUP_OFF || cached) {
+        start = summary_now_ms();
+        sha256(text, size, digest);
+        batch_stage(ctx, STAGE_HASH, start);
+    }
+
+    // Identical content is stripped once; later copies reuse the result
+    DedupEntry local;
+    DedupEntry *entry = &local;
+    memset(&local, 0, sizeof(local));
+    if (ctx->options->dedup != DEDUP_OFF) {
+        int inserted = 0;
+        pthread_mutex_lock(&ctx->lock);
+        DedupEntry *shared = dedup_lookup(&ctx->dedup, digest, &inserted);
+        DedupState state = shared ? shared->state : DEDUP_FAILED;
+        if (shared && !inserted && state == DEDUP_PENDING && dedup_add_waiter(shared, path) == 0) {
+            // The thread stripping the original finishes this path too
+            pthread_mutex_unlock(&ctx->lock);
+            free(code);
+            return;
+        }
+        pthread_mutex_unlock(&ctx->lock);
+
+        if (shared && !inserted && state != DEDUP_PENDING) {
+            free(code);
+            start = summary_now_ms();
+            int ok = state == DEDUP_DONE && finish_file(ctx, path, shared, 1) == 0;
+            batch_stage(ctx, STAGE_WRITE, start);
+            record_file(ctx, shared, ok, 1);
+            free(path);
+            return;
+        }
+        if (shared && inserted) entry = shared;
+    }
+
+    start = summary_now_ms();
+    int stripped = strip_into(ctx, path, text, size, cached ? digest : NULL, entry) == 0;
+    double strip_ms = summary_now_ms() - start;
+    free(code);
+    if (stripped && ctx->options->summary) {
+        summary_add_file(ctx->options->summary, path, strip_ms, size, scan.lines, entry->tokens);
+    }
+
+    start = summary_now_ms();
+    int ok = stripped && finish_file(ctx, path, entry, 0) == 0;
+    batch_stage(ctx, STAGE_WRITE, start);
+    record_file(ctx, entry, ok, 0);
+    free(path);
+
+    if (entry == &local) {
+        dedup_entry_clear(&local);
+        return;
+    }
+
+    // Publish the result, then serve duplicates that arrived meanwhile
+    pthread_mutex_lock(&ctx->lock);
+    entry->state = stripped ? DEDUP_DONE : DEDUP_FAILED;
+    if (entry->result && ctx->dedup.kept_bytes + entry->result_size > DEDUP_KEEP_BYTES) {
+        free(entry->result);
+        entry->result = NULL;
+    } else if (entry->result) {
+        ctx->dedup.kept_bytes += entry->result_size;
+    }
+    char **waiters = entry->waiters;
+    size_t waiter_count = entry->waiter_count;
+    entry->waiters = NULL;
+    entry->waiter_count = 0;
+    entry->waiter_capacity = 0;
+    pthread_mutex_unlock(&ctx->lock);
+
+    for (size_t i = 0; i < waiter_count; i++) {
+        start = summary_now_ms();
+        int waiter_ok = stripped && finish_file(ctx, waiters[i], entry, 1) == 0;
+        batch_stage(ctx, STAGE_WRITE, start);
+        record_file(ctx, entry, waiter_ok, 1);
+        free(waiters[i]);
+    }
+    free(waiters);
+}
+
+// ============================================================================
+// Driver
+// ============================================================================
+
+int batch_run(const BatchOptions *options, BatchStats *stats) {
+    BatchContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.options = options;
+    pthread_mutex_init(&ctx.lock, NULL);
+
+    int cpus = options->jobs > 0 ? options->jobs : pool_default_workers();
+    int threads = options->jobs > 0 ? options->jobs : cpus * BATCH_IO_OVERSUBSCRIBE;
+
+    // Fork the worker processes while this process is still single-threaded
+    if (options->isolate) {
+        ctx.isolate = isolate_create(threads);
+        if (!ctx.isolate) {
+            fprintf(stderr, "Error: Cannot start worker processes\n");
+            pthread_mutex_destroy(&ctx.lock);
+            return -1;
+        }
+    }
+
+    ctx.pool = pool_create_adaptive(cpus, threads);
+    if (!ctx.pool) {
+        fprintf(stderr, "Error: Cannot start worker threads\n");
+        isolate_destroy(ctx.isolate);
+        pthread_mutex_destroy(&ctx.lock);
+        return -1;
+    }
+
+    Jobserver *jobserver = options->jobserver ? jobserver_from_env() : NULL;
+    if (jobserver) {
+        pool_use_jobserver(ctx.pool, jobserver);
+        ctx.stats.jobserver = 1;
+    }
+
+    for (size_t i = 0; i < options->input_count; i++) {
+        char *path = normalize_path(options->inputs[i], strlen(options->inputs[i]));
+        if (path) {
+            batch_enqueue(&ctx, path);
+        }
+    }
+
+    // Jobs enqueue their imports before finishing, so idle means fully crawled
+    pool_wait(ctx.pool);
+
+    PoolStats pool_info;
+    pool_stats(ctx.pool, &pool_info);
+    ctx.stats.cpu_workers = pool_info.cpu_workers;
+    ctx.stats.peak_workers = pool_info.peak_limit;
+    ctx.stats.utilization = pool_info.utilization;
+    ctx.stats.tokens = pool_info.tokens;
+    pool_destroy(ctx.pool);
+    jobserver_close(jobserver);
+    if (ctx.isolate) {
+        ctx.stats.restarts = isolate_restarts(ctx.isolate);
+        isolate_destroy(ctx.isolate);
+    }
+
+    if (options->export_index &&
+        export_index_write(options->export_index, ctx.modules, ctx.module_count) != 0) {
+        ctx.stats.failed++;
+    }
+    for (size_t i = 0; i < ctx.module_count; i++) {
+        index_module_free(&ctx.modules[i]);
+    }
+    free(ctx.modules);
+
+    if (options->manifest && manifest_write(options->manifest, ctx.manifest, ctx.manifest_count) != 0) {
+        ctx.stats.failed++;
+    }
+    for (size_t i = 0; i < ctx.manifest_count; i++) {
+        free(ctx.manifest[i].source);
+        free(ctx.manifest[i].output);
+    }
+    free(ctx.manifest);
+
+    dedup_free(&ctx.dedup);
+    path_set_free(&ctx.seen);
+    pthread_mutex_destroy(&ctx.lock);
+
+    if (options->summary) {
+        Summary *summary = options->summary;
+        summary->files = ctx.stats.files;
+        summary->failed = ctx.stats.failed;
+        size_t settled = ctx.stats.failed + ctx.stats.duplicates + ctx.stats.cache_hits;
+        summary->stripped = ctx.stats.files > settled ? ctx.stats.files - settled : 0;
+        // A file is one lookup whether duplicate detection or the plan cache answers it
+        summary->cache_lookups = options->dedup != DEDUP_OFF ? ctx.stats.files
+                               : ctx.stats.cache_hits + ctx.stats.cache_misses;
+        summary->cache_hits = ctx.stats.duplicates + ctx.stats.cache_hits;
+        summary->skipped = ctx.stats.unresolved;
+        summary->bytes_in = ctx.stats.bytes_in;
+        summary->bytes_out = ctx.stats.bytes_out;
+    }
+
+    if (stats) {
+        *stats = ctx.stats;
+    }
+    return ctx.stats.failed ? -1 : 0;
+}
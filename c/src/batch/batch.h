@@ -0,0 +1,66 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stddef.h>
+#include "../analyzer/input.h"
+#include "../cache/remote.h"
+#include "../summary/summary.h"
+
+// How outputs of byte-identical inputs are produced
+typedef enum {
+    DEDUP_OFF,               // Strip every input
+    DEDUP_COPY,              // Write a copy of the original's output
+    DEDUP_LINK,              // Hard link to the original's output
+    DEDUP_REFLINK            // Clone the original's output (copy-on-write filesystems)
+} DedupMode;
+
+// Thread ceiling, per usable CPU, for I/O-bound (cold cache) runs
+#define BATCH_IO_OVERSUBSCRIBE 4
+
+// Options for stripping many files on the worker pool
+typedef struct {
+    const char **inputs;     // Input files (entry points in crawl mode)
+    size_t input_count;
+    const char *output_dir;  // Mirror outputs under this directory (NULL: overwrite inputs)
+    int jobs;                // Worker threads (<= 0: adapt between the CPU quota and
+                             // BATCH_IO_OVERSUBSCRIBE times that as I/O waits grow)
+    int crawl;               // Follow relative imports and strip only reachable files
+    const char *export_index; // Write the combined exported-symbol index here (NULL: none)
+    DedupMode dedup;         // Strip identical content once (link/copy falls back to copy)
+    int jobserver;           // Share make's job slots when MAKEFLAGS advertises a jobserver
+    int isolate;             // Strip in crash-isolated worker processes
+    const char *cache_dir;   // Edit-plan cache keyed by content hash (NULL: none)
+    RemoteCache *remote;     // Shared edit-plan cache behind cache_dir (NULL: none)
+    int hash_names;          // Put a hash of each output's content into its file name
+    const char *manifest;    // Write source path -> output path here (NULL: none)
+    BomMode bom;             // Keep or drop a leading UTF-8 BOM
+    Summary *summary;        // Stage times and top files go here (NULL: not collected)
+} BatchOptions;
+
+// Counters filled in by batch_run()
+typedef struct {
+    size_t files;            // Files processed
+    size_t failed;           // Files that could not be read, stripped or written
+    size_t duplicates;       // Files served from an identical input's result
+    size_t unresolved;       // Relative imports that matched no file (crawl)
+    size_t cache_hits;       // Files rebuilt from a cached edit plan
+    size_t cache_misses;     // Files looked up in the cache and stripped
+    size_t bytes_in;         // Total input bytes
+    size_t bytes_out;        // Total output bytes
+    int cpu_workers;         // Jobs run at once while CPU-bound
+    int peak_workers;        // Most jobs allowed to run at once
+    double utilization;      // Smoothed CPU time / wall time per job
+    int jobserver;           // A make jobserver limited the workers
+    size_t tokens;           // Jobserver tokens acquired
+    size_t restarts;         // Worker processes replaced after a crash (isolate)
+} BatchStats;
+
+// Strip every input (and, in crawl mode, every file reachable from them)
+// Returns 0 when all files succeeded
+int batch_run(const BatchOptions *options, BatchStats *stats);
+
+// Resolve a relative import specifier against the importing file
+// Probes .ts/.tsx and index.ts/index.tsx; returns a malloc'd path or NULL
+char* resolve_import(const char *importer, const char *specifier, size_t length);
+
+#endif // BATCH_H
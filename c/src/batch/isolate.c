@@ -0,0 +1,427 @@
+#define _GNU_SOURCE
+
+#include "isolate.h"
+#include "../analyzer/tree.h"
+#include "../analyzer/engine.h"
+#include "../io/io.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+// Shared slot layout: header, input, then the output area holding the
+// stripped code followed by dependency and export records
+#define SLOT_HEADER_SIZE 64
+#define SLOT_INPUT_SIZE  (((size_t)(MAX_FILE_SIZE) + 1 + 63) & ~(size_t)63)
+#define SLOT_SIZE        ((size_t)16 * 1024 * 1024)
+#define SLOT_OUTPUT_SIZE (SLOT_SIZE - SLOT_HEADER_SIZE - SLOT_INPUT_SIZE)
+#define RECORD_NONE      UINT32_MAX
+
+typedef struct {
+    int32_t status;          // ISOLATE_OK or ISOLATE_FAILED, set by the worker
+    uint32_t want_exports;
+    uint32_t input_size;
+    uint32_t output_size;
+    uint32_t dep_count;
+    uint32_t export_count;
+    uint32_t token_count;
+} SlotHeader;
+
+typedef struct {
+    uint32_t kind;
+    uint32_t type_only;
+    uint32_t offset;         // Specifier position in the source
+    uint32_t length;
+    uint32_t start;
+    uint32_t end;
+    uint32_t line;
+} DepRecord;
+
+typedef struct {
+    uint32_t name_offset;    // RECORD_NONE for "default" and "*" (see flags)
+    uint32_t name_length;
+    uint32_t from_offset;    // RECORD_NONE for local exports
+    uint32_t from_length;
+    uint32_t flags;
+} ExportRecord;
+
+typedef struct {
+    pid_t pid;               // <= 0 when the worker needs (re)starting
+    int sock;                // Parent end of the wake-up socket
+    unsigned char *slot;
+    int busy;
+} IsolateWorker;
+
+struct IsolatePool {
+    IsolateWorker *workers;
+    int count;
+    pthread_mutex_t lock;
+    pthread_cond_t available;
+    size_t restarts;
+};
+
+static size_t align8(size_t value) {
+    return (value + 7) & ~(size_t)7;
+}
+
+// ============================================================================
+// Worker process
+// ============================================================================
+
+// Analyse the slot's input and write the results back into the slot
+static void worker_serve(unsigned char *slot) {
+    SlotHeader *header = (SlotHeader*)slot;
+    const char *source = (const char*)slot + SLOT_HEADER_SIZE;
+    unsigned char *out = slot + SLOT_HEADER_SIZE + SLOT_INPUT_SIZE;
+    size_t size = header->input_size;
+
+    header->status = ISOLATE_FAILED;
+    header->output_size = 0;
+    header->dep_count = 0;
+    header->export_count = 0;
+    header->token_count = 0;
+
+    AST *ast = NULL;
+    char *result = size ? engine_strip(source, size, &ast) : strdup("");
+    if (!result) {
+        return;
+    }
+
+    ExportList list = {NULL, 0, 0};
+    SyntaxTree *tree = NULL;
+    int ok = 1;
+    if (header->want_exports && ast) {
+        tree = tree_build(ast, source);
+        ok = tree && exports_collect(tree, &list) == 0;
+    }
+
+    size_t result_size = strlen(result);
+    size_t dep_count = ast ? ast->dep_count : 0;
+    size_t deps_at = align8(result_size + 1);
+    size_t exports_at = deps_at + dep_count * sizeof(DepRecord);
+    size_t end = exports_at + list.count * sizeof(ExportRecord);
+
+    if (ok && end <= SLOT_OUTPUT_SIZE) {
+        memcpy(out, result, result_size + 1);
+
+        DepRecord *deps = (DepRecord*)(out + deps_at);
+        for (size_t i = 0; i < dep_count; i++) {
+            const ModuleDep *dep = &ast->deps[i];
+            deps[i] = (DepRecord){ dep->kind, dep->type_only, (uint32_t)(dep->specifier - source),
+                                   dep->length, dep->start, dep->end, dep->line };
+        }
+
+        ExportRecord *exports = (ExportRecord*)(out + exports_at);
+        for (size_t i = 0; i < list.count; i++) {
+            const ExportedSymbol *symbol = &list.symbols[i];
+            // "default" and "*" are not in the source; flags tell them apart
+            int named = symbol->name >= source && symbol->name < source + size;
+            exports[i] = (ExportRecord){
+                named ? (uint32_t)(symbol->name - source) : RECORD_NONE, symbol->name_length,
+                symbol->from ? (uint32_t)(symbol->from - source) : RECORD_NONE,
+                symbol->from_length, symbol->flags
+            };
+        }
+
+        header->output_size = result_size;
+        header->dep_count = dep_count;
+        header->export_count = list.count;
+        header->token_count = ast ? ast->count : 0;
+        header->status = ISOLATE_OK;
+    }
+
+    exports_free(&list);
+    tree_free(tree);
+    free(result);
+    ast_free(ast);
+}
+
+static void worker_main(int sock, unsigned char *slot) {
+    for (;;) {
+        char request;
+        ssize_t got = read(sock, &request, 1);
+        if (got < 0 && errno == EINTR) continue;
+        if (got != 1) return;  // Parent closed the socket
+
+        worker_serve(slot);
+        if (send(sock, "d", 1, MSG_NOSIGNAL) != 1) return;
+    }
+}
+
+// ============================================================================
+// Parent side
+// ============================================================================
+
+// Fork worker i (caller holds the lock, so the fd snapshot is consistent)
+static int spawn_worker(IsolatePool *pool, int index) {
+    IsolateWorker *worker = &pool->workers[index];
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) != 0) return -1;
+
+    // Unwritten stdio data would otherwise be flushed twice
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(sv[0]);
+        close(sv[1]);
+        return -1;
+    }
+
+    if (pid == 0) {
+        // Keep only this worker's socket and slot, so a sibling's death is
+        // still seen by the parent and a wild write cannot reach other slots
+        close(sv[0]);
+        for (int i = 0; i < pool->count; i++) {
+            if (i == index) continue;
+            if (pool->workers[i].sock >= 0) close(pool->workers[i].sock);
+            munmap(pool->workers[i].slot, SLOT_SIZE);
+        }
+        worker_main(sv[1], worker->slot);
+        _exit(0);
+    }
+
+    close(sv[1]);
+    worker->pid = pid;
+    worker->sock = sv[0];
+    return 0;
+}
+
+// Kill and reap a worker that crashed, hung or broke its socket
+static int reap_worker(IsolateWorker *worker) {
+    int status = 0;
+    kill(worker->pid, SIGKILL);
+    while (waitpid(worker->pid, &status, 0) < 0 && errno == EINTR) {}
+    close(worker->sock);
+    worker->sock = -1;
+    worker->pid = 0;
+    return WIFSIGNALED(status) ? WTERMSIG(status) : 0;
+}
+
+IsolatePool* isolate_create(int workers) {
+    if (workers < 1) workers = 1;
+
+    IsolatePool *pool = calloc(1, sizeof(IsolatePool));
+    if (!pool) return NULL;
+    pool->workers = calloc(workers, sizeof(IsolateWorker));
+    if (!pool->workers) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->available, NULL);
+
+    for (int i = 0; i < workers; i++) {
+        pool->workers[i].sock = -1;
+        pool->workers[i].slot = mmap(NULL, SLOT_SIZE, PROT_READ | PROT_WRITE,
+                                     MAP_SHARED | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (pool->workers[i].slot == MAP_FAILED) {
+            pool->workers[i].slot = NULL;
+            break;
+        }
+        pool->count++;
+    }
+
+    for (int i = 0; i < pool->count; i++) {
+        if (spawn_worker(pool, i) != 0) {
+            isolate_destroy(pool);
+            return NULL;
+        }
+    }
+
+    if (pool->count == 0) {
+        isolate_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+// Whether [offset, offset + length) lies inside the source
+static int in_source(uint32_t offset, uint32_t length, size_t size) {
+    return (size_t)offset + length <= size;
+}
+
+// Copy a finished request's results out of the slot. The worker wrote the
+// slot, so every size and offset is checked before use; returns -1 when out
+// of memory, ISOLATE_CRASHED when the slot does not hold valid results.
+static int read_results(const unsigned char *slot, const char *source, size_t size,
+                        IsolateResult *result) {
+    SlotHeader header;
+    memcpy(&header, slot, sizeof(header));
+    const unsigned char *out = slot + SLOT_HEADER_SIZE + SLOT_INPUT_SIZE;
+    if (header.output_size >= SLOT_OUTPUT_SIZE ||
+        header.dep_count > SLOT_OUTPUT_SIZE / sizeof(DepRecord) ||
+        header.export_count > SLOT_OUTPUT_SIZE / sizeof(ExportRecord)) {
+        return ISOLATE_CRASHED;
+    }
+    size_t deps_at = align8((size_t)header.output_size + 1);
+    size_t exports_at = deps_at + header.dep_count * sizeof(DepRecord);
+    if (exports_at + header.export_count * sizeof(ExportRecord) > SLOT_OUTPUT_SIZE) {
+        return ISOLATE_CRASHED;
+    }
+
+    const DepRecord *deps = (const DepRecord*)(out + deps_at);
+    for (size_t i = 0; i < header.dep_count; i++) {
+        if (!in_source(deps[i].offset, deps[i].length, size)) return ISOLATE_CRASHED;
+    }
+    const ExportRecord *exports = (const ExportRecord*)(out + exports_at);
+    for (size_t i = 0; i < header.export_count; i++) {
+        const ExportRecord *record = &exports[i];
+        int named = record->name_offset != RECORD_NONE;
+        if ((named ? !in_source(record->name_offset, record->name_length, size)
+                   : !(record->flags & (EXPORT_DEFAULT | EXPORT_STAR))) ||
+            (record->from_offset != RECORD_NONE && !in_source(record->from_offset, record->from_length, size))) {
+            return ISOLATE_CRASHED;
+        }
+    }
+
+    result->output = malloc(header.output_size + 1);
+    result->deps = malloc((header.dep_count ? header.dep_count : 1) * sizeof(ModuleDep));
+    result->exports.symbols = malloc((header.export_count ? header.export_count : 1) * sizeof(ExportedSymbol));
+    if (!result->output || !result->deps || !result->exports.symbols) return -1;
+
+    memcpy(result->output, out, header.output_size);
+    result->output[header.output_size] = '\0';
+    result->output_size = header.output_size;
+
+    for (size_t i = 0; i < header.dep_count; i++) {
+        result->deps[i] = (ModuleDep){ (DepKind)deps[i].kind, deps[i].type_only,
+                                       source + deps[i].offset, deps[i].length,
+                                       deps[i].start, deps[i].end, (int)deps[i].line };
+    }
+    result->dep_count = header.dep_count;
+    result->token_count = header.token_count;
+
+    for (size_t i = 0; i < header.export_count; i++) {
+        const ExportRecord *record = &exports[i];
+        const char *name;
+        size_t name_length = record->name_length;
+        if (record->name_offset == RECORD_NONE) {
+            name = record->flags & EXPORT_STAR ? "*" : "default";
+            name_length = strlen(name);
+        } else {
+            name = source + record->name_offset;
+        }
+        result->exports.symbols[i] = (ExportedSymbol){
+            name, name_length,
+            record->from_offset == RECORD_NONE ? NULL : source + record->from_offset,
+            record->from_length, record->flags
+        };
+    }
+    result->exports.count = header.export_count;
+    result->exports.capacity = header.export_count;
+    return 0;
+}
+
+int isolate_strip(IsolatePool *pool, const char *source, size_t size,
+                  int want_exports, IsolateResult *result) {
+    memset(result, 0, sizeof(*result));
+    if (size > MAX_FILE_SIZE) return ISOLATE_FAILED;
+
+    pthread_mutex_lock(&pool->lock);
+    int index = -1;
+    while (index < 0) {
+        for (int i = 0; i < pool->count && index < 0; i++) {
+            if (!pool->workers[i].busy) index = i;
+        }
+        if (index < 0) pthread_cond_wait(&pool->available, &pool->lock);
+    }
+    IsolateWorker *worker = &pool->workers[index];
+    worker->busy = 1;
+    int ready = worker->pid > 0 || spawn_worker(pool, index) == 0;
+    pthread_mutex_unlock(&pool->lock);
+
+    int status = ISOLATE_FAILED;
+    if (!ready) {
+        fprintf(stderr, "Error: Cannot start worker process\n");
+    } else {
+        SlotHeader *header = (SlotHeader*)worker->slot;
+        memcpy(worker->slot + SLOT_HEADER_SIZE, source, size);
+        worker->slot[SLOT_HEADER_SIZE + size] = '\0';
+        header->want_exports = want_exports;
+        header->input_size = size;
+        // A worker that answers without finishing leaves the request failed
+        header->status = ISOLATE_FAILED;
+
+        struct pollfd pfd = { .fd = worker->sock, .events = POLLIN };
+        char reply = 0;
+        int answered = send(worker->sock, "r", 1, MSG_NOSIGNAL) == 1;
+        while (answered) {
+            int events = poll(&pfd, 1, ISOLATE_TIMEOUT_MS);
+            if (events < 0 && errno == EINTR) continue;
+            answered = events == 1 && read(worker->sock, &reply, 1) == 1;
+            break;
+        }
+
+        if (answered && header->status == ISOLATE_OK) {
+            status = read_results(worker->slot, source, size, result);
+            if (status != ISOLATE_OK) isolate_result_free(result);
+        }
+
+        // A worker that hung or wrote a corrupt slot is replaced
+        if (!answered || status == ISOLATE_CRASHED) {
+            status = ISOLATE_CRASHED;
+            pthread_mutex_lock(&pool->lock);
+            result->term_signal = reap_worker(worker);
+            pool->restarts++;
+            spawn_worker(pool, index);  // Retried on the next request if it fails
+            pthread_mutex_unlock(&pool->lock);
+        } else if (status != ISOLATE_OK) {
+            status = ISOLATE_FAILED;
+        }
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    worker->busy = 0;
+    pthread_cond_signal(&pool->available);
+    pthread_mutex_unlock(&pool->lock);
+    return status;
+}
+
+void isolate_result_free(IsolateResult *result) {
+    free(result->output);
+    free(result->deps);
+    free(result->exports.symbols);
+    result->output = NULL;
+    result->deps = NULL;
+    result->exports.symbols = NULL;
+    result->exports.count = 0;
+}
+
+size_t isolate_restarts(IsolatePool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    size_t restarts = pool->restarts;
+    pthread_mutex_unlock(&pool->lock);
+    return restarts;
+}
+
+void isolate_destroy(IsolatePool *pool) {
+    if (!pool) return;
+
+    // Closing the socket makes an idle worker exit on its own
+    for (int i = 0; i < pool->count; i++) {
+        IsolateWorker *worker = &pool->workers[i];
+        if (worker->sock >= 0) close(worker->sock);
+    }
+    for (int i = 0; i < pool->count; i++) {
+        IsolateWorker *worker = &pool->workers[i];
+        if (worker->pid > 0) {
+            while (waitpid(worker->pid, NULL, 0) < 0 && errno == EINTR) {}
+        }
+        munmap(worker->slot, SLOT_SIZE);
+    }
+
+    pthread_cond_destroy(&pool->available);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
@@ -0,0 +1,49 @@
+#ifndef ISOLATE_H
+#define ISOLATE_H
+
+#include <stddef.h>
+#include "../analyzer/analyzer.h"
+#include "../analyzer/exports.h"
+
+// Pre-forked worker processes that lex, strip and index untrusted input so a
+// crash takes down one worker instead of the whole batch. Each worker owns a
+// shared-memory slot: the caller copies the source in, wakes the worker over
+// a socket, and reads the results back in place. Dead or hung workers are
+// replaced on the next request.
+typedef struct IsolatePool IsolatePool;
+
+// isolate_strip() status codes
+#define ISOLATE_OK       0
+#define ISOLATE_FAILED  -1   // The stripper rejected the input
+#define ISOLATE_CRASHED -2   // The worker died or timed out
+
+// A worker that does not answer within this long is killed
+#define ISOLATE_TIMEOUT_MS 30000
+
+// Results of one request; pointers into the source refer to the caller's copy
+typedef struct {
+    char *output;            // Stripped code (malloc'd, NUL-terminated)
+    size_t output_size;
+    ModuleDep *deps;         // Module specifiers found while lexing
+    size_t dep_count;
+    ExportList exports;      // Collected when requested
+    size_t token_count;      // Tokens lexed
+    int term_signal;         // Signal that killed the worker (ISOLATE_CRASHED)
+} IsolateResult;
+
+// Fork the worker processes; call before starting threads where possible
+IsolatePool* isolate_create(int workers);
+
+// Strip source in a worker, waiting for a free one if all are busy
+int isolate_strip(IsolatePool *pool, const char *source, size_t size,
+                  int want_exports, IsolateResult *result);
+
+void isolate_result_free(IsolateResult *result);
+
+// Number of workers that had to be restarted
+size_t isolate_restarts(IsolatePool *pool);
+
+// Stop the workers and free the pool
+void isolate_destroy(IsolatePool *pool);
+
+#endif // ISOLATE_H
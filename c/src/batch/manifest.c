@@ -0,0 +1,120 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "manifest.h"
+#include "../io/io.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MANIFEST_HEADER_SIZE 32
+#define MANIFEST_ENTRY_SIZE  (16 + SHA256_SIZE)
+
+char* manifest_hashed_name(const char *path, const unsigned char digest[SHA256_SIZE]) {
+    char hex[SHA256_HEX_SIZE];
+    hash_to_hex(digest, SHA256_SIZE, hex);
+
+    // The extension is the last '.' of the file name, not of a directory
+    const char *slash = strrchr(path, '/');
+    const char *name = slash ? slash + 1 : path;
+    const char *dot = strrchr(name, '.');
+    if (!dot || dot == name) dot = name + strlen(name);
+
+    size_t stem = (size_t)(dot - path);
+    size_t length = strlen(path) + MANIFEST_NAME_HASH_CHARS + 2;
+    char *out = malloc(length);
+    if (out) {
+        snprintf(out, length, "%.*s.%.*s%s", (int)stem, path, MANIFEST_NAME_HASH_CHARS, hex, dot);
+    }
+    return out;
+}
+
+static int compare_entries(const void *a, const void *b) {
+    return strcmp(((const ManifestEntry*)a)->source, ((const ManifestEntry*)b)->source);
+}
+
+static void put_u32(unsigned char *out, uint32_t value) {
+    out[0] = (unsigned char)value;
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+static int write_json(FILE *file, const ManifestEntry *entries, size_t count) {
+    fprintf(file, "{");
+    for (size_t i = 0; i < count; i++) {
+        fprintf(file, "%s\n  ", i ? "," : "");
+        write_json_string(file, entries[i].source, strlen(entries[i].source));
+        fprintf(file, ": ");
+        write_json_string(file, entries[i].output, strlen(entries[i].output));
+    }
+    fprintf(file, "%s}\n", count ? "\n" : "");
+    return ferror(file) ? -1 : 0;
+}
+
+static int write_binary(FILE *file, const ManifestEntry *entries, size_t count) {
+    size_t string_bytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        string_bytes += strlen(entries[i].source) + strlen(entries[i].output);
+    }
+
+    size_t string_offset = MANIFEST_HEADER_SIZE + count * MANIFEST_ENTRY_SIZE;
+    size_t total = string_offset + string_bytes;
+    if (total > UINT32_MAX) {
+        fprintf(stderr, "Error: Manifest too large\n");
+        return -1;
+    }
+
+    unsigned char *buffer = calloc(1, total);
+    if (!buffer) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+
+    memcpy(buffer, MANIFEST_MAGIC, 8);
+    put_u32(buffer + 8, MANIFEST_VERSION);
+    put_u32(buffer + 12, (uint32_t)count);
+    put_u32(buffer + 16, (uint32_t)string_bytes);
+
+    unsigned char *strings = buffer + string_offset;
+    size_t string_used = 0;
+    for (size_t i = 0; i < count; i++) {
+        unsigned char *record = buffer + MANIFEST_HEADER_SIZE + i * MANIFEST_ENTRY_SIZE;
+        size_t source_length = strlen(entries[i].source);
+        size_t output_length = strlen(entries[i].output);
+
+        put_u32(record, (uint32_t)string_used);
+        put_u32(record + 4, (uint32_t)source_length);
+        memcpy(strings + string_used, entries[i].source, source_length);
+        string_used += source_length;
+
+        put_u32(record + 8, (uint32_t)string_used);
+        put_u32(record + 12, (uint32_t)output_length);
+        memcpy(strings + string_used, entries[i].output, output_length);
+        string_used += output_length;
+
+        memcpy(record + 16, entries[i].digest, SHA256_SIZE);
+    }
+
+    int status = fwrite(buffer, 1, total, file) == total ? 0 : -1;
+    free(buffer);
+    return status;
+}
+
+int manifest_write(const char *filepath, ManifestEntry *entries, size_t count) {
+    qsort(entries, count, sizeof(ManifestEntry), compare_entries);
+
+    size_t length = strlen(filepath);
+    int json = length >= 5 && strcmp(filepath + length - 5, ".json") == 0;
+    FILE *file = fopen(filepath, json ? "w" : "wb");
+    if (!file) {
+        fprintf(stderr, "Error: Cannot open file '%s' for writing\n", filepath);
+        return -1;
+    }
+
+    int status = json ? write_json(file, entries, count) : write_binary(file, entries, count);
+    if (fclose(file) != 0) status = -1;
+    if (status != 0) {
+        fprintf(stderr, "Error: Cannot write manifest '%s'\n", filepath);
+    }
+    return status;
+}
@@ -0,0 +1,42 @@
+#ifndef MANIFEST_H
+#define MANIFEST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../hash/hash.h"
+
+// Hex digits of the content hash put into hashed output names
+#define MANIFEST_NAME_HASH_CHARS 8
+
+// ============================================================================
+// Manifest file
+// ============================================================================
+//
+// JSON (when the path ends in ".json"): an object mapping each source path to
+// its output path, sorted by source path.
+//
+// Binary otherwise, little-endian, every field a uint32 unless noted:
+//
+//   header   magic[8] "TSOUTMAP", version, entry_count, string_bytes,
+//            reserved[3]
+//   entries  entry_count x { source_offset, source_length, output_offset,
+//            output_length, sha256[32] bytes of the output } sorted by source
+//   strings  string_bytes of UTF-8, offsets are relative to its start
+
+#define MANIFEST_MAGIC   "TSOUTMAP"
+#define MANIFEST_VERSION 1
+
+typedef struct {
+    char *source;
+    char *output;
+    unsigned char digest[SHA256_SIZE];
+} ManifestEntry;
+
+// Name the output after its content: "dir/name.ext" -> "dir/name.<hash>.ext"
+// Returns a malloc'd path
+char* manifest_hashed_name(const char *path, const unsigned char digest[SHA256_SIZE]);
+
+// Sort entries and write them to filepath; returns 0 on success
+int manifest_write(const char *filepath, ManifestEntry *entries, size_t count);
+
+#endif // MANIFEST_H
@@ -0,0 +1,446 @@
+#define _GNU_SOURCE
+
+#include "cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define PLAN_MAGIC "TSEP"
+
+// On-disk layout: header, edits as LEB128 triples (bytes copied since the
+// previous edit, removed, inserted), dep records, literal pool
+typedef struct {
+    char magic[4];
+    uint32_t format;
+    uint32_t input_size;
+    uint32_t output_size;
+    uint32_t token_count;
+    uint32_t edit_count;
+    uint32_t edit_bytes;
+    uint32_t dep_count;
+    uint32_t literal_size;
+} PlanHeader;
+
+// Longest LEB128 encoding of a uint32_t
+#define VARINT_MAX 5
+
+// Larger files under the cache directory are not plans written by plan_store()
+#define MAX_PLAN_SIZE (16 * 1024 * 1024)
+
+static atomic_ulong temp_counter;
+
+// ============================================================================
+// Building and applying plans
+// ============================================================================
+
+// Append an edit, merging it into the previous one when nothing is copied between
+static int plan_add_edit(EditPlan *plan, size_t *capacity, size_t offset, size_t removed,
+                         const char *inserted, size_t inserted_size) {
+    if (inserted_size) {
+        char *literals = realloc(plan->literals, plan->literal_size + inserted_size);
+        if (!literals) return -1;
+        memcpy(literals + plan->literal_size, inserted, inserted_size);
+        plan->literals = literals;
+        plan->literal_size += inserted_size;
+    }
+
+    PlanEdit *last = plan->edit_count ? &plan->edits[plan->edit_count - 1] : NULL;
+    if (last && (size_t)last->offset + last->removed == offset) {
+        last->removed += (uint32_t)removed;
+        last->inserted += (uint32_t)inserted_size;
+        return 0;
+    }
+
+    if (plan->edit_count >= *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 64;
+        PlanEdit *edits = realloc(plan->edits, *capacity * sizeof(PlanEdit));
+        if (!edits) return -1;
+        plan->edits = edits;
+    }
+    plan->edits[plan->edit_count++] = (PlanEdit){ (uint32_t)offset, (uint32_t)removed, (uint32_t)inserted_size };
+    return 0;
+}
+
+static size_t common_run(const char *a, size_t a_size, const char *b, size_t b_size, size_t limit) {
+    size_t n = 0;
+    while (n < limit && n < a_size && n < b_size && a[n] == b[n]) n++;
+    return n;
+}
+
+// Within PLAN_WINDOW bytes of input, the first of up to PLAN_CANDIDATES
+// occurrences of want[0] agreeing for want_size bytes, else the longest-agreeing
+static const char* plan_resync(const char *input, size_t input_size, const char *want,
+                               size_t want_size, size_t *best_run) {
+    const char *from = input;
+    const char *end = input + (input_size < PLAN_WINDOW ? input_size : PLAN_WINDOW);
+    const char *best = NULL;
+    *best_run = 0;
+    for (int tries = 0; tries < PLAN_CANDIDATES && from < end; tries++) {
+        const char *found = memchr(from, want[0], (size_t)(end - from));
+        if (!found) break;
+        size_t run = common_run(found, (size_t)(input + input_size - found), want, want_size, want_size);
+        if (run > *best_run) {
+            best = found;
+            *best_run = run;
+            if (run >= want_size) break;
+        }
+        from = found + 1;
+    }
+    return best;
+}
+
+int plan_build(const char *input, size_t input_size, const char *output, size_t output_size,
+               EditPlan *plan) {
+    memset(plan, 0, sizeof(*plan));
+    if (input_size > UINT32_MAX || output_size > UINT32_MAX) return -1;
+    plan->input_size = input_size;
+    plan->output_size = output_size;
+
+    size_t capacity = 0;
+    size_t i = 0;
+    size_t j = 0;
+    while (j < output_size) {
+        if (i < input_size && input[i] == output[j]) {
+            i++;
+            j++;
+            continue;
+        }
+
+        // Resynchronize: for each count of inserted bytes, find the first nearby
+        // input position that agrees with the output for PLAN_ANCHOR bytes (or
+        // the rest of the output), else the one that agrees longest; prefer
+        // anchored positions, then the fewest skipped plus inserted bytes
+        size_t best_skip = 0;
+        size_t best_insert = 0;
+        size_t best_run = 0;
+        int best_anchored = 0;
+        for (size_t insert = 0; insert <= PLAN_MAX_INSERT && j + insert < output_size; insert++) {
+            size_t want = output_size - j - insert < PLAN_ANCHOR ? output_size - j - insert : PLAN_ANCHOR;
+            size_t run;
+            const char *found = plan_resync(input + i, input_size - i, output + j + insert, want, &run);
+            if (!found) continue;
+
+            size_t skip = (size_t)(found - (input + i));
+            int anchored = run >= want;
+            int better = anchored != best_anchored ? anchored
+                       : anchored ? skip + insert < best_skip + best_insert
+                       : run > best_run || (run == best_run && skip + insert < best_skip + best_insert);
+            if (best_run == 0 || better) {
+                best_skip = skip;
+                best_insert = insert;
+                best_run = run;
+                best_anchored = anchored;
+            }
+        }
+
+        // Bytes that cannot be found nearby become literals too
+        if (best_run == 0) {
+            best_insert = 1;
+        }
+        if (plan_add_edit(plan, &capacity, i, best_skip, output + j, best_insert) != 0) {
+            plan_free(plan);
+            return -1;
+        }
+        i += best_skip;
+        j += best_insert;
+    }
+    if (i < input_size && plan_add_edit(plan, &capacity, i, input_size - i, NULL, 0) != 0) {
+        plan_free(plan);
+        return -1;
+    }
+
+    // Keep the plan only if it reproduces the output and is smaller than it
+    char *check = plan_apply(plan, input, input_size);
+    int ok = check && memcmp(check, output, output_size) == 0 &&
+             plan->edit_count * sizeof(PlanEdit) + plan->literal_size < output_size;
+    free(check);
+    if (!ok) {
+        plan_free(plan);
+        return -1;
+    }
+    return 0;
+}
+
+int plan_set_deps(EditPlan *plan, const char *input, const ModuleDep *deps, size_t count) {
+    free(plan->deps);
+    plan->deps = malloc((count ? count : 1) * sizeof(PlanDep));
+    plan->dep_count = 0;
+    if (!plan->deps) return -1;
+    for (size_t i = 0; i < count; i++) {
+        const ModuleDep *dep = &deps[i];
+        plan->deps[i] = (PlanDep){ dep->kind, dep->type_only, (uint32_t)(dep->specifier - input),
+                                   (uint32_t)dep->length, (uint32_t)dep->start, (uint32_t)dep->end,
+                                   (uint32_t)dep->line };
+    }
+    plan->dep_count = count;
+    return 0;
+}
+
+size_t plan_apply_into(const EditPlan *plan, const char *input, size_t input_size, char *out) {
+    if (input_size != plan->input_size) return SIZE_MAX;
+
+    size_t i = 0;
+    size_t n = 0;
+    const char *literal = plan->literals;
+    size_t literal_left = plan->literal_size;
+    for (size_t k = 0; k < plan->edit_count; k++) {
+        const PlanEdit *edit = &plan->edits[k];
+        if (edit->offset < i || edit->offset + (size_t)edit->removed > input_size ||
+            edit->inserted > literal_left ||
+            n + (edit->offset - i) + edit->inserted > plan->output_size) {
+            return SIZE_MAX;
+        }
+        size_t copy = edit->offset - i;
+        memcpy(out + n, input + i, copy);
+        n += copy;
+        if (edit->inserted) {
+            // Plans without literals carry no pool at all
+            memcpy(out + n, literal, edit->inserted);
+            n += edit->inserted;
+            literal += edit->inserted;
+            literal_left -= edit->inserted;
+        }
+        i = edit->offset + edit->removed;
+    }
+    if (n + (input_size - i) != plan->output_size) {
+        return SIZE_MAX;
+    }
+    memcpy(out + n, input + i, input_size - i);
+    out[plan->output_size] = '\0';
+    return plan->output_size;
+}
+
+char* plan_apply(const EditPlan *plan, const char *input, size_t input_size) {
+    char *out = malloc(plan->output_size + 1);
+    if (out && plan_apply_into(plan, input, input_size, out) == SIZE_MAX) {
+        free(out);
+        return NULL;
+    }
+    return out;
+}
+
+void plan_module_deps(const EditPlan *plan, const char *input, ModuleDep *deps) {
+    for (size_t i = 0; i < plan->dep_count; i++) {
+        const PlanDep *dep = &plan->deps[i];
+        deps[i] = (ModuleDep){ (DepKind)dep->kind, (int)dep->type_only, input + dep->offset,
+                               dep->length, dep->start, dep->end, (int)dep->line };
+    }
+}
+
+void plan_free(EditPlan *plan) {
+    free(plan->edits);
+    free(plan->literals);
+    free(plan->deps);
+    memset(plan, 0, sizeof(*plan));
+}
+
+// ============================================================================
+// Storage
+// ============================================================================
+
+char* plan_path(const char *dir, const unsigned char digest[SHA256_SIZE]) {
+    char hex[SHA256_HEX_SIZE];
+    hash_to_hex(digest, SHA256_SIZE, hex);
+
+    size_t length = strlen(dir) + SHA256_HEX_SIZE + sizeof("/xx/.plan");
+    char *path = malloc(length);
+    if (path) {
+        snprintf(path, length, "%s/%.2s/%s.plan", dir, hex, hex + 2);
+    }
+    return path;
+}
+
+static unsigned char* put_varint(unsigned char *p, uint32_t value) {
+    while (value >= 0x80) {
+        *p++ = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = (unsigned char)value;
+    return p;
+}
+
+static const unsigned char* get_varint(const unsigned char *p, const unsigned char *end, uint32_t *value) {
+    uint32_t result = 0;
+    for (int shift = 0; p < end && shift < 35; shift += 7) {
+        unsigned char byte = *p++;
+        result |= (uint32_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return p;
+        }
+    }
+    return NULL;
+}
+
+unsigned char* plan_encode(const EditPlan *plan, size_t *size) {
+    size_t capacity = sizeof(PlanHeader) + plan->edit_count * 3 * VARINT_MAX +
+                      plan->dep_count * sizeof(PlanDep) + plan->literal_size;
+    unsigned char *buffer = malloc(capacity);
+    if (!buffer) return NULL;
+
+    unsigned char *p = buffer + sizeof(PlanHeader);
+    size_t end = 0;
+    for (size_t k = 0; k < plan->edit_count; k++) {
+        const PlanEdit *edit = &plan->edits[k];
+        p = put_varint(p, (uint32_t)(edit->offset - end));
+        p = put_varint(p, edit->removed);
+        p = put_varint(p, edit->inserted);
+        end = edit->offset + edit->removed;
+    }
+
+    PlanHeader header;
+    memcpy(header.magic, PLAN_MAGIC, 4);
+    header.format = PLAN_FORMAT;
+    header.input_size = (uint32_t)plan->input_size;
+    header.output_size = (uint32_t)plan->output_size;
+    header.token_count = (uint32_t)plan->token_count;
+    header.edit_count = (uint32_t)plan->edit_count;
+    header.edit_bytes = (uint32_t)(p - (buffer + sizeof(PlanHeader)));
+    header.dep_count = (uint32_t)plan->dep_count;
+    header.literal_size = (uint32_t)plan->literal_size;
+    memcpy(buffer, &header, sizeof(header));
+
+    if (plan->dep_count) {
+        memcpy(p, plan->deps, plan->dep_count * sizeof(PlanDep));
+        p += plan->dep_count * sizeof(PlanDep);
+    }
+    if (plan->literal_size) {
+        memcpy(p, plan->literals, plan->literal_size);
+        p += plan->literal_size;
+    }
+    *size = (size_t)(p - buffer);
+    return buffer;
+}
+
+int plan_decode(const unsigned char *data, size_t size, EditPlan *plan) {
+    PlanHeader header;
+    if (size < sizeof(header)) return -1;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, PLAN_MAGIC, 4) != 0 || header.format != PLAN_FORMAT) return -1;
+
+    size_t deps_size = (size_t)header.dep_count * sizeof(PlanDep);
+    if (size != sizeof(header) + (size_t)header.edit_bytes + deps_size + header.literal_size) return -1;
+    // Every edit takes at least three varint bytes
+    if (header.edit_count > header.edit_bytes / 3) return -1;
+
+    plan->input_size = header.input_size;
+    plan->output_size = header.output_size;
+    plan->token_count = header.token_count;
+    plan->edits = malloc((header.edit_count ? header.edit_count : 1) * sizeof(PlanEdit));
+    plan->deps = malloc(deps_size ? deps_size : 1);
+    plan->literals = malloc(header.literal_size ? header.literal_size : 1);
+    if (!plan->edits || !plan->deps || !plan->literals) return -1;
+
+    const unsigned char *p = data + sizeof(header);
+    const unsigned char *edits_end = p + header.edit_bytes;
+    size_t end = 0;
+    size_t removed_total = 0;
+    size_t inserted_total = 0;
+    for (uint32_t k = 0; k < header.edit_count; k++) {
+        uint32_t gap, removed, inserted;
+        if (!(p = get_varint(p, edits_end, &gap)) || !(p = get_varint(p, edits_end, &removed)) ||
+            !(p = get_varint(p, edits_end, &inserted)) ||
+            end + gap + removed > header.input_size ||
+            inserted_total + inserted > header.literal_size) {
+            return -1;
+        }
+        plan->edits[k] = (PlanEdit){ (uint32_t)(end + gap), removed, inserted };
+        plan->edit_count++;
+        end += (size_t)gap + removed;
+        removed_total += removed;
+        inserted_total += inserted;
+    }
+    // The literal pool is used up exactly and the sizes agree with the edits
+    if (p != edits_end || inserted_total != header.literal_size ||
+        header.output_size != header.input_size - removed_total + inserted_total) {
+        return -1;
+    }
+
+    memcpy(plan->deps, p, deps_size);
+    plan->dep_count = header.dep_count;
+    memcpy(plan->literals, p + deps_size, header.literal_size);
+    plan->literal_size = header.literal_size;
+
+    // Specifiers are rebuilt as pointers into the input; keep them inside it
+    for (size_t i = 0; i < plan->dep_count; i++) {
+        if ((size_t)plan->deps[i].offset + plan->deps[i].length > plan->input_size) return -1;
+    }
+    return 0;
+}
+
+int plan_load(const char *dir, const unsigned char digest[SHA256_SIZE], EditPlan *plan) {
+    memset(plan, 0, sizeof(*plan));
+    char *path = plan_path(dir, digest);
+    int fd = path ? open(path, O_RDONLY) : -1;
+    free(path);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    unsigned char *data = NULL;
+    int ok = fstat(fd, &st) == 0 && st.st_size <= MAX_PLAN_SIZE &&
+             (data = malloc(st.st_size ? st.st_size : 1)) != NULL &&
+             read(fd, data, st.st_size) == (ssize_t)st.st_size &&
+             plan_decode(data, st.st_size, plan) == 0;
+    close(fd);
+    free(data);
+
+    if (!ok) {
+        plan_free(plan);
+        return -1;
+    }
+    return 0;
+}
+
+static int write_all(int fd, const void *data, size_t size) {
+    const char *p = data;
+    while (size > 0) {
+        ssize_t written = write(fd, p, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += written;
+        size -= written;
+    }
+    return 0;
+}
+
+int plan_store(const char *dir, const unsigned char digest[SHA256_SIZE], const EditPlan *plan) {
+    char *path = plan_path(dir, digest);
+    if (!path) return -1;
+
+    // Create dir and the fan-out directory; a failure shows up at open()
+    mkdir(dir, 0755);
+    char *slash = strrchr(path, '/');
+    *slash = '\0';
+    mkdir(path, 0755);
+    *slash = '/';
+
+    // Write beside the final name, then rename so readers never see a partial plan
+    size_t temp_length = strlen(path) + 48;
+    char *temp = malloc(temp_length);
+    if (!temp) {
+        free(path);
+        return -1;
+    }
+    snprintf(temp, temp_length, "%s.%ld.%lu.tmp", path, (long)getpid(),
+             atomic_fetch_add(&temp_counter, 1));
+
+    size_t size = 0;
+    unsigned char *data = plan_encode(plan, &size);
+    int fd = data ? open(temp, O_WRONLY | O_CREAT | O_EXCL, 0644) : -1;
+    int ok = fd >= 0 && write_all(fd, data, size) == 0;
+    if (fd >= 0 && close(fd) != 0) ok = 0;
+    if (ok && rename(temp, path) != 0) ok = 0;
+    if (!ok && fd >= 0) unlink(temp);
+
+    free(data);
+    free(temp);
+    free(path);
+    return ok ? 0 : -1;
+}
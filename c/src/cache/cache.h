@@ -0,0 +1,90 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../analyzer/analyzer.h"
+#include "../hash/hash.h"
+
+// Stored plans carry this number; bump it whenever stripping output changes
+// so plans written by older builds are ignored
+#define PLAN_FORMAT 3
+
+// Plans are derived by diffing input and output: after a mismatch the next
+// output bytes are looked up (at most PLAN_CANDIDATES times, within
+// PLAN_WINDOW input bytes) allowing up to PLAN_MAX_INSERT inserted bytes,
+// the stripper's own additions being a space or two
+#define PLAN_ANCHOR     4
+#define PLAN_CANDIDATES 8
+#define PLAN_WINDOW     (64 * 1024)
+#define PLAN_MAX_INSERT 2
+
+// One edit: at input offset, drop removed bytes and insert inserted bytes
+// taken from the literal pool; everything between edits is copied
+typedef struct {
+    uint32_t offset;
+    uint32_t removed;
+    uint32_t inserted;
+} PlanEdit;
+
+// Module specifier, stored by position so it can be rebuilt over the input
+typedef struct {
+    uint32_t kind;
+    uint32_t type_only;
+    uint32_t offset;         // Specifier position in the input
+    uint32_t length;
+    uint32_t start;
+    uint32_t end;
+    uint32_t line;
+} PlanDep;
+
+// How to turn one input into its stripped output, keyed by the input's SHA-256
+typedef struct {
+    size_t input_size;
+    size_t output_size;
+    size_t token_count;      // Tokens lexed (for summaries)
+    PlanEdit *edits;
+    size_t edit_count;
+    char *literals;          // Inserted bytes, in edit order
+    size_t literal_size;
+    PlanDep *deps;
+    size_t dep_count;
+} EditPlan;
+
+// Derive the edit list that turns input into output
+// Returns -1 when output is not a compact edit of input (nothing to cache)
+int plan_build(const char *input, size_t input_size, const char *output, size_t output_size,
+               EditPlan *plan);
+
+// Record the module specifiers found while stripping (they point into input)
+int plan_set_deps(EditPlan *plan, const char *input, const ModuleDep *deps, size_t count);
+
+// Rebuild the output (malloc'd, NUL-terminated); NULL when input does not fit the plan
+char* plan_apply(const EditPlan *plan, const char *input, size_t input_size);
+
+// plan_apply() into out (output_size + 1 bytes); returns output_size or SIZE_MAX
+size_t plan_apply_into(const EditPlan *plan, const char *input, size_t input_size, char *out);
+
+// Rebuild the module specifiers over input into deps (plan->dep_count entries)
+void plan_module_deps(const EditPlan *plan, const char *input, ModuleDep *deps);
+
+void plan_free(EditPlan *plan);
+
+// Serialized plan as stored on disk and by the remote cache (malloc'd)
+unsigned char* plan_encode(const EditPlan *plan, size_t *size);
+
+// Parse a serialized plan into an empty plan; -1 when it is malformed or
+// from another PLAN_FORMAT (free plan either way)
+int plan_decode(const unsigned char *data, size_t size, EditPlan *plan);
+
+// Where digest's plan lives under dir: dir/xx/<remaining hex>.plan (malloc'd)
+char* plan_path(const char *dir, const unsigned char digest[SHA256_SIZE]);
+
+// Look up the plan for digest under dir; returns 0 on a hit, -1 otherwise
+int plan_load(const char *dir, const unsigned char digest[SHA256_SIZE], EditPlan *plan);
+
+// Store a plan under dir (dir/xx/<hex>.plan, replaced atomically)
+// Returns 0 on success; failures leave the cache unchanged
+int plan_store(const char *dir, const unsigned char digest[SHA256_SIZE], const EditPlan *plan);
+
+#endif // CACHE_H
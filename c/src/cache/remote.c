@@ -0,0 +1,583 @@
+#define _GNU_SOURCE
+
+#include "remote.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+// Weight of the newest sample in the smoothed round trip and local speed
+#define SMOOTHING 0.2
+
+typedef enum {
+    REQUEST_GET,
+    REQUEST_PUT
+} RequestKind;
+
+struct RemoteRequest {
+    RequestKind kind;
+    char hex[SHA256_HEX_SIZE];
+    unsigned char *body;         // PUT: plan to send; GET: plan received
+    size_t body_size;
+    int status;                  // HTTP status, -1 on failure, 0 while in flight
+    int abandoned;               // The caller gave up; the I/O thread frees it
+    double sent_ms;              // Written to the connection, 0 before (guarded by the lock)
+    double deadline_ms;          // When the caller stops waiting
+    struct RemoteRequest *next;
+};
+
+// Growable byte buffer; data[start, size) is unconsumed
+typedef struct {
+    char *data;
+    size_t start;
+    size_t size;
+    size_t capacity;
+} Buffer;
+
+// The I/O thread's connection and the requests written on it, in order
+typedef struct {
+    int fd;
+    Buffer out;
+    Buffer in;
+    RemoteRequest *head;
+    RemoteRequest *tail;
+    double progress_ms;          // Last time bytes moved (or a request was first queued)
+} Connection;
+
+struct RemoteCache {
+    char *host;
+    char *port;
+    char *prefix;                // Path before /ac/, without a trailing '/'
+    int timeout_ms;              // Per lookup, or REMOTE_RACE
+
+    pthread_t thread;
+    int wake[2];                 // Pokes the I/O thread
+    pthread_mutex_t lock;
+    pthread_cond_t changed;      // A request finished
+    RemoteRequest *queued;       // Not yet written, oldest first
+    RemoteRequest *queued_tail;
+    int stopping;
+    double down_until;           // Skip the remote until then
+    double ns_per_byte;          // Smoothed local stripping cost (0: unknown)
+    double probe_at;             // Race mode: next lookup sent despite a slow round trip
+    RemoteStats stats;
+};
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static int buffer_append(Buffer *buffer, const void *data, size_t size) {
+    if (buffer->start > 0 && buffer->start == buffer->size) {
+        buffer->start = buffer->size = 0;
+    }
+    if (buffer->size + size > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+        while (capacity < buffer->size + size) capacity *= 2;
+        char *grown = realloc(buffer->data, capacity);
+        if (!grown) return -1;
+        buffer->data = grown;
+        buffer->capacity = capacity;
+    }
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+    return 0;
+}
+
+// ============================================================================
+// Requests
+// ============================================================================
+
+// Hand a finished request to its caller, or free it when nobody waits
+static void request_done(RemoteCache *remote, RemoteRequest *request, int status) {
+    pthread_mutex_lock(&remote->lock);
+    if (status > 0) {
+        // Faster round trips are taken at once, so a slow connect or a spike
+        // does not keep race mode from sending lookups for long
+        double rtt = now_ms() - request->sent_ms;
+        remote->stats.rtt_ms = remote->stats.rtt_ms > 0 && rtt > remote->stats.rtt_ms
+            ? remote->stats.rtt_ms + SMOOTHING * (rtt - remote->stats.rtt_ms) : rtt;
+    }
+    if (status < 0 || (status >= 400 && status != 404)) remote->stats.errors++;
+    if (request->kind == REQUEST_PUT && status >= 200 && status < 300) remote->stats.uploads++;
+
+    int owned = request->kind == REQUEST_PUT || request->abandoned;
+    request->status = status;
+    if (!owned) pthread_cond_broadcast(&remote->changed);
+    pthread_mutex_unlock(&remote->lock);
+
+    if (owned) {
+        free(request->body);
+        free(request);
+    }
+}
+
+static void enqueue(RemoteCache *remote, RemoteRequest *request) {
+    // Caller holds the lock
+    if (remote->queued_tail) {
+        remote->queued_tail->next = request;
+    } else {
+        remote->queued = request;
+    }
+    remote->queued_tail = request;
+}
+
+static void wake(RemoteCache *remote) {
+    char byte = 0;
+    if (write(remote->wake[1], &byte, 1) < 0) {
+        // Full pipe: the thread is due to wake anyway
+    }
+}
+
+// Milliseconds a race-mode lookup may take for an input of size bytes
+static double race_budget(const RemoteCache *remote, size_t size) {
+    double expected = remote->ns_per_byte * (double)size / 1e6;
+    return expected > REMOTE_RACE_MIN_MS ? expected : REMOTE_RACE_MIN_MS;
+}
+
+RemoteRequest* remote_lookup(RemoteCache *remote, const unsigned char digest[SHA256_SIZE],
+                             size_t input_size) {
+    double now = now_ms();
+    pthread_mutex_lock(&remote->lock);
+    double budget = remote->timeout_ms == REMOTE_RACE ? race_budget(remote, input_size)
+                                                      : (double)remote->timeout_ms;
+    // A hit has to come back before stripping locally would have finished;
+    // an occasional probe still goes out to refresh the round trip time
+    int slow = remote->timeout_ms == REMOTE_RACE && remote->ns_per_byte > 0 &&
+               remote->stats.rtt_ms > budget;
+    if (slow && now >= remote->probe_at) {
+        slow = 0;
+        remote->probe_at = now + REMOTE_PROBE_MS;
+    }
+    int skip = now < remote->down_until || slow;
+    RemoteRequest *request = skip ? NULL : calloc(1, sizeof(RemoteRequest));
+    if (!request) {
+        remote->stats.skipped++;
+        pthread_mutex_unlock(&remote->lock);
+        return NULL;
+    }
+
+    request->kind = REQUEST_GET;
+    hash_to_hex(digest, SHA256_SIZE, request->hex);
+    request->deadline_ms = now + budget;
+    enqueue(remote, request);
+    remote->stats.lookups++;
+    pthread_mutex_unlock(&remote->lock);
+    wake(remote);
+    return request;
+}
+
+int remote_lookup_finish(RemoteCache *remote, RemoteRequest *request, EditPlan *plan) {
+    memset(plan, 0, sizeof(*plan));
+    if (!request) return -1;
+
+    struct timespec deadline;
+    deadline.tv_sec = (time_t)(request->deadline_ms / 1e3);
+    deadline.tv_nsec = (long)((request->deadline_ms - deadline.tv_sec * 1e3) * 1e6);
+
+    pthread_mutex_lock(&remote->lock);
+    while (request->status == 0 &&
+           pthread_cond_timedwait(&remote->changed, &remote->lock, &deadline) != ETIMEDOUT) {
+    }
+    if (request->status == 0) {
+        // Too late to beat local stripping; the I/O thread drops the answer
+        request->abandoned = 1;
+        remote->stats.late++;
+        // Once on the wire, the round trip takes at least this long, so race
+        // mode stops sending lookups that cannot win (until a probe answers)
+        double waited = request->sent_ms > 0 ? now_ms() - request->sent_ms : 0;
+        if (waited > remote->stats.rtt_ms) remote->stats.rtt_ms = waited;
+        pthread_mutex_unlock(&remote->lock);
+        return -1;
+    }
+    pthread_mutex_unlock(&remote->lock);
+
+    int hit = request->status == 200 && plan_decode(request->body, request->body_size, plan) == 0;
+    if (!hit) {
+        plan_free(plan);
+    } else {
+        pthread_mutex_lock(&remote->lock);
+        remote->stats.hits++;
+        pthread_mutex_unlock(&remote->lock);
+    }
+    free(request->body);
+    free(request);
+    return hit ? 0 : -1;
+}
+
+void remote_note_strip(RemoteCache *remote, size_t bytes, double ms) {
+    if (!remote || bytes == 0 || ms <= 0) return;
+    double sample = ms * 1e6 / (double)bytes;
+    pthread_mutex_lock(&remote->lock);
+    remote->ns_per_byte = remote->ns_per_byte > 0
+        ? remote->ns_per_byte + SMOOTHING * (sample - remote->ns_per_byte) : sample;
+    pthread_mutex_unlock(&remote->lock);
+}
+
+void remote_store(RemoteCache *remote, const unsigned char digest[SHA256_SIZE], const EditPlan *plan) {
+    RemoteRequest *request = calloc(1, sizeof(RemoteRequest));
+    if (!request) return;
+    request->kind = REQUEST_PUT;
+    hash_to_hex(digest, SHA256_SIZE, request->hex);
+    request->body = plan_encode(plan, &request->body_size);
+    if (!request->body) {
+        free(request);
+        return;
+    }
+
+    pthread_mutex_lock(&remote->lock);
+    int down = now_ms() < remote->down_until;
+    if (!down) enqueue(remote, request);
+    pthread_mutex_unlock(&remote->lock);
+    if (down) {
+        free(request->body);
+        free(request);
+        return;
+    }
+    wake(remote);
+}
+
+// ============================================================================
+// I/O thread
+// ============================================================================
+
+// Open a TCP connection, giving up after REMOTE_IO_TIMEOUT_MS
+static int connect_remote(const RemoteCache *remote) {
+    struct addrinfo hints, *addresses;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(remote->host, remote->port, &hints, &addresses) != 0) return -1;
+
+    int fd = -1;
+    for (struct addrinfo *a = addresses; a && fd < 0; a = a->ai_next) {
+        fd = socket(a->ai_family, a->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, a->ai_protocol);
+        if (fd < 0) continue;
+
+        int ok = connect(fd, a->ai_addr, a->ai_addrlen) == 0;
+        if (!ok && errno == EINPROGRESS) {
+            struct pollfd p = { fd, POLLOUT, 0 };
+            int error = 0;
+            socklen_t length = sizeof(error);
+            ok = poll(&p, 1, REMOTE_IO_TIMEOUT_MS) == 1 &&
+                 getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0;
+        }
+        if (!ok) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(addresses);
+
+    if (fd >= 0) {
+        // Requests are small and pipelined: do not hold them back
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+// Fail every request written on the connection and close it
+static void connection_reset(RemoteCache *remote, Connection *c) {
+    while (c->head) {
+        RemoteRequest *request = c->head;
+        c->head = request->next;
+        request_done(remote, request, -1);
+    }
+    c->tail = NULL;
+    if (c->fd >= 0) close(c->fd);
+    c->fd = -1;
+    c->out.start = c->out.size = 0;
+    c->in.start = c->in.size = 0;
+}
+
+// Serialize request onto the connection
+static int connection_send(RemoteCache *remote, Connection *c, RemoteRequest *request) {
+    char header[512];
+    int length;
+    if (request->kind == REQUEST_GET) {
+        length = snprintf(header, sizeof(header), "GET %s/ac/%s HTTP/1.1\r\nHost: %s:%s\r\n\r\n",
+                          remote->prefix, request->hex, remote->host, remote->port);
+    } else {
+        length = snprintf(header, sizeof(header),
+                          "PUT %s/ac/%s HTTP/1.1\r\nHost: %s:%s\r\n"
+                          "Content-Type: application/octet-stream\r\nContent-Length: %zu\r\n\r\n",
+                          remote->prefix, request->hex, remote->host, remote->port, request->body_size);
+    }
+    if (length < 0 || (size_t)length >= sizeof(header) ||
+        buffer_append(&c->out, header, (size_t)length) != 0 ||
+        (request->kind == REQUEST_PUT && buffer_append(&c->out, request->body, request->body_size) != 0)) {
+        return -1;
+    }
+    if (request->kind == REQUEST_PUT) {
+        free(request->body);
+        request->body = NULL;
+    }
+
+    double now = now_ms();
+    pthread_mutex_lock(&remote->lock);
+    request->sent_ms = now;
+    pthread_mutex_unlock(&remote->lock);
+    request->next = NULL;
+    if (!c->head) c->progress_ms = now;
+    if (c->tail) {
+        c->tail->next = request;
+    } else {
+        c->head = request;
+    }
+    c->tail = request;
+    return 0;
+}
+
+// Value of header name in head[0, size), or NULL
+static const char* header_value(const char *head, size_t size, const char *name) {
+    size_t length = strlen(name);
+    const char *end = head + size;
+    for (const char *line = head; line < end; ) {
+        const char *next = memchr(line, '\n', (size_t)(end - line));
+        if (!next) break;
+        if ((size_t)(next - line) > length && strncasecmp(line, name, length) == 0 && line[length] == ':') {
+            const char *value = line + length + 1;
+            while (*value == ' ') value++;
+            return value;
+        }
+        line = next + 1;
+    }
+    return NULL;
+}
+
+// Complete every fully received response; -1 when the stream is unusable
+static int connection_receive(RemoteCache *remote, Connection *c) {
+    for (;;) {
+        const char *data = c->in.data + c->in.start;
+        size_t available = c->in.size - c->in.start;
+        const char *blank = available >= 4 ? memmem(data, available, "\r\n\r\n", 4) : NULL;
+        if (!blank) return available > 64 * 1024 ? -1 : 0;
+
+        size_t head_size = (size_t)(blank - data) + 4;
+        int status;
+        if (!c->head || sscanf(data, "HTTP/1.%*d %d", &status) != 1) return -1;
+        if (header_value(data, head_size, "Transfer-Encoding")) return -1;  // Not supported
+
+        const char *length_value = header_value(data, head_size, "Content-Length");
+        size_t body_size = length_value ? strtoul(length_value, NULL, 10) : 0;
+        if (body_size > REMOTE_MAX_BODY) return -1;
+        if (available < head_size + body_size) return 0;
+
+        const char *connection = header_value(data, head_size, "Connection");
+        int closing = connection && strncasecmp(connection, "close", 5) == 0;
+
+        RemoteRequest *request = c->head;
+        c->head = request->next;
+        if (!c->head) c->tail = NULL;
+        if (request->kind == REQUEST_GET && status == 200) {
+            request->body = malloc(body_size ? body_size : 1);
+            if (request->body) {
+                memcpy(request->body, data + head_size, body_size);
+                request->body_size = body_size;
+            } else {
+                status = -1;
+            }
+        }
+        c->in.start += head_size + body_size;
+        request_done(remote, request, status);
+
+        if (closing) return -1;
+    }
+}
+
+static void* remote_thread(void *arg) {
+    RemoteCache *remote = arg;
+    Connection c;
+    memset(&c, 0, sizeof(c));
+    c.fd = -1;
+
+    for (;;) {
+        pthread_mutex_lock(&remote->lock);
+        RemoteRequest *fresh = remote->queued;
+        remote->queued = remote->queued_tail = NULL;
+        int stopping = remote->stopping;
+        pthread_mutex_unlock(&remote->lock);
+
+        while (fresh) {
+            RemoteRequest *request = fresh;
+            fresh = request->next;
+            if (c.fd < 0 && now_ms() >= remote->down_until) {
+                c.fd = connect_remote(remote);
+                if (c.fd < 0) {
+                    fprintf(stderr, "Warning: Cannot connect to cache server %s:%s\n", remote->host, remote->port);
+                    pthread_mutex_lock(&remote->lock);
+                    remote->down_until = now_ms() + REMOTE_RETRY_MS;
+                    pthread_mutex_unlock(&remote->lock);
+                }
+            }
+            if (c.fd < 0 || connection_send(remote, &c, request) != 0) {
+                request_done(remote, request, -1);
+            }
+        }
+        if (stopping && !c.head) break;
+
+        int timeout = -1;
+        if (c.head) {
+            double left = c.progress_ms + REMOTE_IO_TIMEOUT_MS - now_ms();
+            if (left <= 0) {
+                // The server stopped answering
+                connection_reset(remote, &c);
+                continue;
+            }
+            timeout = (int)left + 1;
+        }
+
+        struct pollfd fds[2] = { { remote->wake[0], POLLIN, 0 }, { c.fd, 0, 0 } };
+        if (c.head) fds[1].events |= POLLIN;
+        if (c.out.size > c.out.start) fds[1].events |= POLLOUT;
+        int ready = poll(fds, c.fd >= 0 ? 2 : 1, timeout);
+        if (ready < 0 && errno != EINTR) break;
+        if (ready <= 0) continue;
+
+        if (fds[0].revents & POLLIN) {
+            char drain[64];
+            while (read(remote->wake[0], drain, sizeof(drain)) > 0) {}
+        }
+        if (c.fd < 0) continue;
+
+        int failed = (fds[1].revents & (POLLERR | POLLNVAL)) != 0;
+        if (!failed && (fds[1].revents & POLLOUT)) {
+            ssize_t sent = send(c.fd, c.out.data + c.out.start, c.out.size - c.out.start, MSG_NOSIGNAL);
+            if (sent > 0) {
+                c.out.start += (size_t)sent;
+                c.progress_ms = now_ms();
+            } else if (sent < 0 && errno != EAGAIN && errno != EINTR) {
+                failed = 1;
+            }
+        }
+        if (!failed && (fds[1].revents & (POLLIN | POLLHUP))) {
+            char chunk[16384];
+            ssize_t received = recv(c.fd, chunk, sizeof(chunk), 0);
+            if (received > 0) {
+                c.progress_ms = now_ms();
+                failed = buffer_append(&c.in, chunk, (size_t)received) != 0 ||
+                         connection_receive(remote, &c) != 0;
+            } else if (received == 0 || (errno != EAGAIN && errno != EINTR)) {
+                failed = 1;
+            }
+        }
+        if (failed) connection_reset(remote, &c);
+    }
+
+    connection_reset(remote, &c);
+    free(c.out.data);
+    free(c.in.data);
+    return NULL;
+}
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+
+// Split "http://host[:port][/prefix]"; -1 when url has another form
+static int parse_url(RemoteCache *remote, const char *url) {
+    if (strncmp(url, "http://", 7) != 0) return -1;
+    const char *host = url + 7;
+    const char *host_end;
+    const char *rest;
+    if (*host == '[') {
+        // IPv6 literal
+        host_end = strchr(host, ']');
+        if (!host_end) return -1;
+        host++;
+        rest = host_end + 1;
+    } else {
+        host_end = host + strcspn(host, ":/");
+        rest = host_end;
+    }
+    if (host_end == host) return -1;
+
+    const char *port = "80";
+    size_t port_length = 2;
+    if (*rest == ':') {
+        port = rest + 1;
+        port_length = strcspn(port, "/");
+        if (port_length == 0) return -1;
+        rest = port + port_length;
+    }
+    if (*rest && *rest != '/') return -1;
+
+    size_t prefix_length = strlen(rest);
+    while (prefix_length > 0 && rest[prefix_length - 1] == '/') prefix_length--;
+
+    remote->host = strndup(host, (size_t)(host_end - host));
+    remote->port = strndup(port, port_length);
+    remote->prefix = strndup(rest, prefix_length);
+    return remote->host && remote->port && remote->prefix ? 0 : -1;
+}
+
+RemoteCache* remote_open(const char *url, int timeout_ms) {
+    RemoteCache *remote = calloc(1, sizeof(RemoteCache));
+    if (!remote) return NULL;
+    remote->timeout_ms = timeout_ms;
+    remote->wake[0] = remote->wake[1] = -1;
+
+    if (parse_url(remote, url) != 0) {
+        fprintf(stderr, "Error: Invalid cache URL '%s' (expected http://host[:port][/prefix])\n", url);
+        remote_close(remote, NULL);
+        return NULL;
+    }
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&remote->lock, NULL);
+    pthread_cond_init(&remote->changed, &attr);
+    pthread_condattr_destroy(&attr);
+
+    if (pipe2(remote->wake, O_NONBLOCK | O_CLOEXEC) != 0 ||
+        pthread_create(&remote->thread, NULL, remote_thread, remote) != 0) {
+        fprintf(stderr, "Error: Cannot start the remote cache client\n");
+        if (remote->wake[0] >= 0) {
+            close(remote->wake[0]);
+            close(remote->wake[1]);
+            remote->wake[0] = remote->wake[1] = -1;
+        }
+        pthread_cond_destroy(&remote->changed);
+        pthread_mutex_destroy(&remote->lock);
+        remote_close(remote, NULL);
+        return NULL;
+    }
+    return remote;
+}
+
+void remote_close(RemoteCache *remote, RemoteStats *stats) {
+    if (!remote) return;
+
+    if (remote->wake[0] >= 0) {
+        pthread_mutex_lock(&remote->lock);
+        remote->stopping = 1;
+        pthread_mutex_unlock(&remote->lock);
+        wake(remote);
+        pthread_join(remote->thread, NULL);
+
+        close(remote->wake[0]);
+        close(remote->wake[1]);
+        pthread_cond_destroy(&remote->changed);
+        pthread_mutex_destroy(&remote->lock);
+    }
+
+    if (stats) *stats = remote->stats;
+    free(remote->host);
+    free(remote->port);
+    free(remote->prefix);
+    free(remote);
+}
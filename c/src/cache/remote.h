@@ -0,0 +1,79 @@
+#ifndef REMOTE_H
+#define REMOTE_H
+
+#include <stddef.h>
+#include "cache.h"
+
+// Remote edit-plan cache over HTTP/1.1, laid out like a Bazel remote HTTP
+// cache: the plan for an input is GET/PUT at <prefix>/ac/<input sha256>
+// (bazel-remote needs --disable_http_ac_validation, since plans are not
+// ActionResult messages). One keep-alive connection carries every request;
+// requests are pipelined by an I/O thread, so lookups never wait for each
+// other and callers keep working while theirs is in flight.
+
+// Requests fail and the connection is dropped after this long without progress
+#define REMOTE_IO_TIMEOUT_MS 5000
+
+// After a failed connect the remote is skipped (every lookup misses) this long
+#define REMOTE_RETRY_MS 5000
+
+// Race mode waits no longer than stripping locally is expected to take,
+// but at least this long (the first inputs, before any local timing)
+#define REMOTE_RACE_MIN_MS 0.5
+
+// Largest response body accepted
+#define REMOTE_MAX_BODY (16 * 1024 * 1024)
+
+// While race mode skips lookups because round trips look too slow, one is
+// still sent this often so the estimate can recover
+#define REMOTE_PROBE_MS 1000
+
+// Wait limit for lookups in race mode (pass as timeout_ms)
+#define REMOTE_RACE (-1)
+
+typedef struct RemoteCache RemoteCache;
+typedef struct RemoteRequest RemoteRequest;
+
+// Counters since remote_open()
+typedef struct {
+    size_t lookups;          // Lookups sent
+    size_t hits;             // Plans received in time
+    size_t late;             // Lookups given up on (timeout or race lost)
+    size_t skipped;          // Lookups not sent: remote down, or a round trip costs more than stripping
+    size_t errors;           // Requests failed by the connection or the server
+    size_t uploads;          // Plans stored
+    double rtt_ms;           // Smoothed round trip time
+} RemoteStats;
+
+// Parse url ("http://host[:port][/prefix]") and start the I/O thread; the
+// connection is opened on first use. timeout_ms bounds each lookup, or
+// REMOTE_RACE. Returns NULL (with an error printed) for a bad URL.
+RemoteCache* remote_open(const char *url, int timeout_ms);
+
+// Start looking up the plan for digest; never blocks. NULL when the lookup
+// is skipped (the remote is down, or in race mode a round trip is known to
+// take longer than stripping input_size bytes).
+RemoteRequest* remote_lookup(RemoteCache *remote, const unsigned char digest[SHA256_SIZE],
+                             size_t input_size);
+
+// Wait for a lookup (within the timeout, or in race mode the expected local
+// stripping time) and decode the plan; returns 0 on a hit. Consumes request.
+int remote_lookup_finish(RemoteCache *remote, RemoteRequest *request, EditPlan *plan);
+
+// Tell race mode how long a local strip took
+void remote_note_strip(RemoteCache *remote, size_t bytes, double ms);
+
+// Queue an upload of plan (best effort, never blocks)
+void remote_store(RemoteCache *remote, const unsigned char digest[SHA256_SIZE], const EditPlan *plan);
+
+// Send queued uploads (bounded by REMOTE_IO_TIMEOUT_MS), stop the I/O
+// thread and free the cache; stats (may be NULL) gets the final counters
+void remote_close(RemoteCache *remote, RemoteStats *stats);
+
+// Serve a cache directory over HTTP/1.1 on address ("[host:]port") until
+// SIGINT or SIGTERM: GET/PUT /ac/<sha256> reads and writes plans in the
+// --cache-dir layout (uploads must decode), and /cas/<sha256> stores blobs
+// whose SHA-256 matches the name. Returns -1 when the address cannot be bound.
+int remote_serve(const char *address, const char *dir);
+
+#endif // REMOTE_H
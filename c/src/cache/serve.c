@@ -0,0 +1,363 @@
+#define _GNU_SOURCE
+
+#include "remote.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+
+// Minimal cache server for tests and single-host setups: one thread, one
+// poll() loop, keep-alive connections answered in request order (so
+// pipelined clients work), whole bodies buffered in memory.
+
+#define SERVE_MAX_CLIENTS 256
+#define SERVE_MAX_HEAD    (16 * 1024)
+
+typedef struct {
+    int fd;
+    char *in;
+    size_t in_size;
+    size_t in_capacity;
+    char *out;
+    size_t out_start;
+    size_t out_size;
+    size_t out_capacity;
+    int closing;             // Close once out is flushed
+} Client;
+
+static volatile sig_atomic_t serve_stop;
+static atomic_ulong temp_counter;
+
+static void on_signal(int sig) {
+    (void)sig;
+    serve_stop = 1;
+}
+
+static int append(char **data, size_t *size, size_t *capacity, const void *bytes, size_t length) {
+    if (*size + length > *capacity) {
+        size_t grown = *capacity ? *capacity : 4096;
+        while (grown < *size + length) grown *= 2;
+        char *p = realloc(*data, grown);
+        if (!p) return -1;
+        *data = p;
+        *capacity = grown;
+    }
+    memcpy(*data + *size, bytes, length);
+    *size += length;
+    return 0;
+}
+
+static void respond(Client *client, int status, const char *reason, const void *body, size_t size) {
+    char head[160];
+    int length = snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nContent-Length: %zu\r\n%s\r\n",
+                          status, reason, size, client->closing ? "Connection: close\r\n" : "");
+    if (client->out_start == client->out_size) client->out_start = client->out_size = 0;
+    if (append(&client->out, &client->out_size, &client->out_capacity, head, (size_t)length) != 0 ||
+        (size && append(&client->out, &client->out_size, &client->out_capacity, body, size) != 0)) {
+        client->closing = 1;
+    }
+}
+
+// "/.../ac/<hex>" or "/.../cas/<hex>": is_cas and digest; -1 otherwise
+static int parse_target(const char *path, size_t length, int *is_cas, unsigned char digest[SHA256_SIZE]) {
+    if (length < SHA256_HEX_SIZE) return -1;
+    const char *hex = path + length - (SHA256_HEX_SIZE - 1);
+    if (hex[-1] != '/') return -1;
+    if (hex - path >= 4 && memcmp(hex - 4, "/ac/", 4) == 0) {
+        *is_cas = 0;
+    } else if (hex - path >= 5 && memcmp(hex - 5, "/cas/", 5) == 0) {
+        *is_cas = 1;
+    } else {
+        return -1;
+    }
+
+    for (size_t i = 0; i < SHA256_SIZE; i++) {
+        unsigned value = 0;
+        for (int k = 0; k < 2; k++) {
+            char c = hex[2 * i + k];
+            int nibble = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                       : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+            if (nibble < 0) return -1;
+            value = value * 16 + (unsigned)nibble;
+        }
+        digest[i] = (unsigned char)value;
+    }
+    return 0;
+}
+
+// Plans keep the --cache-dir layout; blobs go to dir/cas/xx/<remaining hex>
+static char* blob_path(const char *dir, int is_cas, const unsigned char digest[SHA256_SIZE]) {
+    if (!is_cas) return plan_path(dir, digest);
+
+    char hex[SHA256_HEX_SIZE];
+    hash_to_hex(digest, SHA256_SIZE, hex);
+    size_t length = strlen(dir) + SHA256_HEX_SIZE + sizeof("/cas/xx/");
+    char *path = malloc(length);
+    if (path) snprintf(path, length, "%s/cas/%.2s/%s", dir, hex, hex + 2);
+    return path;
+}
+
+// Only uploads that cannot spread corruption are stored: blobs whose SHA-256
+// matches their name, and plans that decode
+static int valid_blob(int is_cas, const unsigned char digest[SHA256_SIZE], const char *data, size_t size) {
+    if (is_cas) {
+        unsigned char actual[SHA256_SIZE];
+        sha256(data, size, actual);
+        return memcmp(actual, digest, SHA256_SIZE) == 0;
+    }
+    EditPlan plan;
+    memset(&plan, 0, sizeof(plan));
+    int ok = plan_decode((const unsigned char*)data, size, &plan) == 0;
+    plan_free(&plan);
+    return ok;
+}
+
+// Write data to path through a temporary file and rename
+static int store_blob(const char *path, const char *data, size_t size) {
+    // Create the missing directories above path
+    char *parents = strdup(path);
+    if (!parents) return -1;
+    for (char *p = parents + 1; *p; p++) {
+        if (*p != '/') continue;
+        *p = '\0';
+        mkdir(parents, 0755);
+        *p = '/';
+    }
+    free(parents);
+
+    size_t temp_length = strlen(path) + 48;
+    char *temp = malloc(temp_length);
+    if (!temp) return -1;
+    snprintf(temp, temp_length, "%s.%ld.%lu.tmp", path, (long)getpid(), atomic_fetch_add(&temp_counter, 1));
+
+    int fd = open(temp, O_WRONLY | O_CREAT | O_EXCL, 0644);
+    int ok = fd >= 0;
+    for (size_t done = 0; ok && done < size; ) {
+        ssize_t written = write(fd, data + done, size - done);
+        if (written < 0 && errno == EINTR) continue;
+        if (written < 0) ok = 0; else done += (size_t)written;
+    }
+    if (fd >= 0 && close(fd) != 0) ok = 0;
+    if (ok && rename(temp, path) != 0) ok = 0;
+    if (!ok && fd >= 0) unlink(temp);
+    free(temp);
+    return ok ? 0 : -1;
+}
+
+static void handle_get(Client *client, const char *path) {
+    int fd = path ? open(path, O_RDONLY) : -1;
+    struct stat st;
+    char *data = NULL;
+    int ok = fd >= 0 && fstat(fd, &st) == 0 && st.st_size <= REMOTE_MAX_BODY &&
+             (data = malloc(st.st_size ? st.st_size : 1)) != NULL &&
+             read(fd, data, st.st_size) == (ssize_t)st.st_size;
+    if (fd >= 0) close(fd);
+
+    if (ok) {
+        respond(client, 200, "OK", data, (size_t)st.st_size);
+    } else {
+        respond(client, 404, "Not Found", NULL, 0);
+    }
+    free(data);
+}
+
+// Answer every complete request buffered for client; -1 to drop it
+static int serve_requests(Client *client, const char *dir) {
+    size_t used = 0;
+    while (!client->closing) {
+        char *data = client->in + used;
+        size_t available = client->in_size - used;
+        char *blank = available >= 4 ? memmem(data, available, "\r\n\r\n", 4) : NULL;
+        if (!blank) {
+            if (available > SERVE_MAX_HEAD) return -1;
+            break;
+        }
+        size_t head_size = (size_t)(blank - data) + 4;
+
+        // Header lookup within this request only
+        *blank = '\0';
+        char method[8], target[512];
+        int parsed = sscanf(data, "%7s %511s HTTP/1.%*d", method, target) == 2;
+        size_t body_size = 0;
+        for (char *line = strstr(data, "\r\n"); line; line = strstr(line + 2, "\r\n")) {
+            if (strncasecmp(line + 2, "Content-Length:", 15) == 0) body_size = strtoul(line + 17, NULL, 10);
+            if (strncasecmp(line + 2, "Connection:", 11) == 0 && strcasestr(line + 13, "close")) client->closing = 1;
+            if (strncasecmp(line + 2, "Transfer-Encoding:", 18) == 0) parsed = 0;
+        }
+        *blank = '\r';
+
+        if (!parsed || body_size > REMOTE_MAX_BODY) {
+            client->closing = 1;
+            respond(client, body_size > REMOTE_MAX_BODY ? 413 : 400,
+                    body_size > REMOTE_MAX_BODY ? "Payload Too Large" : "Bad Request", NULL, 0);
+            break;
+        }
+        if (available < head_size + body_size) break;
+        const char *body = data + head_size;
+        used += head_size + body_size;
+
+        int is_cas;
+        unsigned char digest[SHA256_SIZE];
+        char *query = strchr(target, '?');
+        if (query) *query = '\0';
+        if (parse_target(target, strlen(target), &is_cas, digest) != 0) {
+            respond(client, 404, "Not Found", NULL, 0);
+            continue;
+        }
+        char *path = blob_path(dir, is_cas, digest);
+
+        if (strcmp(method, "GET") == 0) {
+            handle_get(client, path);
+        } else if (strcmp(method, "PUT") == 0) {
+            if (!valid_blob(is_cas, digest, body, body_size)) {
+                respond(client, 400, "Bad Request", NULL, 0);
+            } else if (path && store_blob(path, body, body_size) == 0) {
+                respond(client, 200, "OK", NULL, 0);
+            } else {
+                respond(client, 500, "Internal Server Error", NULL, 0);
+            }
+        } else {
+            respond(client, 405, "Method Not Allowed", NULL, 0);
+        }
+        free(path);
+    }
+
+    memmove(client->in, client->in + used, client->in_size - used);
+    client->in_size -= used;
+    return 0;
+}
+
+static void client_drop(Client *client) {
+    close(client->fd);
+    free(client->in);
+    free(client->out);
+    memset(client, 0, sizeof(*client));
+    client->fd = -1;
+}
+
+static int listen_on(const char *address) {
+    const char *colon = strrchr(address, ':');
+    char *host = colon ? strndup(address, (size_t)(colon - address)) : NULL;
+    const char *port = colon ? colon + 1 : address;
+    if (host && host[0] == '[') {
+        // [IPv6]:port
+        memmove(host, host + 1, strlen(host));
+        host[strcspn(host, "]")] = '\0';
+    }
+
+    struct addrinfo hints, *addresses;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    int status = getaddrinfo(host && *host ? host : NULL, port, &hints, &addresses);
+    free(host);
+    if (status != 0) return -1;
+
+    int fd = -1;
+    for (struct addrinfo *a = addresses; a && fd < 0; a = a->ai_next) {
+        fd = socket(a->ai_family, a->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, a->ai_protocol);
+        if (fd < 0) continue;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (bind(fd, a->ai_addr, a->ai_addrlen) != 0 || listen(fd, 64) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(addresses);
+    return fd;
+}
+
+int remote_serve(const char *address, const char *dir) {
+    int listener = listen_on(address);
+    if (listener < 0) {
+        fprintf(stderr, "Error: Cannot listen on '%s'\n", address);
+        return -1;
+    }
+    mkdir(dir, 0755);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_signal;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    fprintf(stderr, "Serving cache directory '%s' on %s\n", dir, address);
+
+    Client clients[SERVE_MAX_CLIENTS];
+    for (int i = 0; i < SERVE_MAX_CLIENTS; i++) clients[i].fd = -1;
+    struct pollfd fds[SERVE_MAX_CLIENTS + 1];
+
+    while (!serve_stop) {
+        fds[0] = (struct pollfd){ listener, POLLIN, 0 };
+        for (int i = 0; i < SERVE_MAX_CLIENTS; i++) {
+            Client *client = &clients[i];
+            short events = client->out_size > client->out_start ? POLLOUT : (client->closing ? 0 : POLLIN);
+            fds[i + 1] = (struct pollfd){ client->fd, events, 0 };
+        }
+        if (poll(fds, SERVE_MAX_CLIENTS + 1, -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int fd;
+            while ((fd = accept4(listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+                int slot = 0;
+                while (slot < SERVE_MAX_CLIENTS && clients[slot].fd >= 0) slot++;
+                if (slot == SERVE_MAX_CLIENTS) {
+                    close(fd);  // Full: the client retries or falls back to stripping
+                    continue;
+                }
+                memset(&clients[slot], 0, sizeof(Client));
+                clients[slot].fd = fd;
+            }
+        }
+
+        for (int i = 0; i < SERVE_MAX_CLIENTS; i++) {
+            Client *client = &clients[i];
+            short revents = fds[i + 1].revents;
+            if (client->fd < 0 || !revents) continue;
+
+            int drop = (revents & (POLLERR | POLLNVAL)) != 0;
+            if (!drop && (revents & (POLLIN | POLLHUP))) {
+                char chunk[16384];
+                ssize_t received = recv(client->fd, chunk, sizeof(chunk), 0);
+                if (received > 0) {
+                    drop = append(&client->in, &client->in_size, &client->in_capacity, chunk, (size_t)received) != 0 ||
+                           serve_requests(client, dir) != 0;
+                } else if (received == 0 || (errno != EAGAIN && errno != EINTR)) {
+                    drop = 1;
+                }
+            }
+            if (!drop && client->out_size > client->out_start) {
+                ssize_t sent = send(client->fd, client->out + client->out_start,
+                                    client->out_size - client->out_start, MSG_NOSIGNAL);
+                if (sent > 0) {
+                    client->out_start += (size_t)sent;
+                } else if (sent < 0 && errno != EAGAIN && errno != EINTR) {
+                    drop = 1;
+                }
+            }
+            if (drop || (client->closing && client->out_start == client->out_size)) {
+                client_drop(client);
+            }
+        }
+    }
+
+    for (int i = 0; i < SERVE_MAX_CLIENTS; i++) {
+        if (clients[i].fd >= 0) client_drop(&clients[i]);
+    }
+    close(listener);
+    return 0;
+}
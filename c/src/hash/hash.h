@@ -0,0 +1,28 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_SIZE 32
+#define SHA256_HEX_SIZE (SHA256_SIZE * 2 + 1)
+
+// Incremental SHA-256 state
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;         // Bytes hashed so far
+    unsigned char block[64];
+    size_t used;             // Bytes buffered in block
+} Sha256;
+
+void sha256_init(Sha256 *ctx);
+void sha256_update(Sha256 *ctx, const void *data, size_t size);
+void sha256_final(Sha256 *ctx, unsigned char digest[SHA256_SIZE]);
+
+// One-shot digest of a buffer
+void sha256(const void *data, size_t size, unsigned char digest[SHA256_SIZE]);
+
+// Lowercase hex encoding; hex must hold size * 2 + 1 bytes
+void hash_to_hex(const unsigned char *digest, size_t size, char *hex);
+
+#endif // HASH_H
@@ -0,0 +1,376 @@
+#define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE  // vmsplice(), F_SETPIPE_SZ
+
+#include "io.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#define mkdir(path, mode) _mkdir(path)
+#else
+#include <unistd.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#endif
+
+char* read_file(const char *filepath, size_t *size) {
+    FILE *file = fopen(filepath, "r");
+    if (!file) {
+        fprintf(stderr, "Error: Cannot open file '%s'\n", filepath);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    if (*size > MAX_FILE_SIZE) {
+        fprintf(stderr, "Error: File too large (max %d bytes)\n", MAX_FILE_SIZE);
+        fclose(file);
+        return NULL;
+    }
+
+    char *content = malloc(*size + 1);
+    if (!content) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        fclose(file);
+        return NULL;
+    }
+
+    size_t read_size = fread(content, 1, *size, file);
+    content[read_size] = '\0';
+    *size = read_size;
+
+    fclose(file);
+    return content;
+}
+
+char* read_stdin(size_t *size) {
+    size_t capacity = 4096;
+    size_t length = 0;
+    char *content = malloc(capacity);
+    
+    if (!content) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return NULL;
+    }
+
+    size_t chunk_size;
+    while ((chunk_size = fread(content + length, 1, capacity - length, stdin)) > 0) {
+        length += chunk_size;
+        if (length >= capacity - 1) {
+            capacity *= 2;
+            if (capacity > MAX_FILE_SIZE) {
+                fprintf(stderr, "Error: Input too large (max %d bytes)\n", MAX_FILE_SIZE);
+                free(content);
+                return NULL;
+            }
+            char *new_content = realloc(content, capacity);
+            if (!new_content) {
+                fprintf(stderr, "Error: Memory reallocation failed\n");
+                free(content);
+                return NULL;
+            }
+            content = new_content;
+        }
+    }
+
+    content[length] = '\0';
+    *size = length;
+    return content;
+}
+
+int write_output(const char *filepath, const char *content) {
+    if (strcmp(filepath, "-") == 0) {
+        // Write to stdout
+        printf("%s", content);
+        return 0;
+    }
+
+    FILE *file = fopen(filepath, "w");
+    if (!file) {
+        fprintf(stderr, "Error: Cannot open file '%s' for writing\n", filepath);
+        return -1;
+    }
+
+    // A full disk surfaces as a failed write or close
+    int ok = fprintf(file, "%s", content) >= 0;
+    if (fclose(file) != 0) ok = 0;
+    if (!ok) {
+        fprintf(stderr, "Error: Cannot write file '%s'\n", filepath);
+        return -1;
+    }
+    return 0;
+}
+
+#ifndef _WIN32
+static atomic_ulong temp_counter;
+
+int mapped_output_open(MappedOutput *out, const char *filepath, size_t capacity) {
+    memset(out, 0, sizeof(*out));
+    out->fd = -1;
+    if (capacity == 0) return -1;
+
+    size_t length = strlen(filepath) + 64;
+    out->temp = malloc(length);
+    if (!out->temp) return -1;
+
+    // Created like fopen() would (0666 less the umask), not mkstemp()'s 0600;
+    // a destination that exists keeps its mode, as when it is overwritten
+    for (int attempt = 0; attempt < 16 && out->fd < 0; attempt++) {
+        snprintf(out->temp, length, "%s.%ld.%lu.tmp", filepath, (long)getpid(),
+                 atomic_fetch_add(&temp_counter, 1));
+        out->fd = open(out->temp, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+        if (out->fd < 0 && errno != EEXIST) break;
+    }
+    struct stat existing;
+    if (out->fd >= 0 && stat(filepath, &existing) == 0) {
+        fchmod(out->fd, existing.st_mode & 0777);
+    }
+    if (out->fd < 0) {
+        fprintf(stderr, "Error: Cannot open file '%s' for writing\n", filepath);
+        free(out->temp);
+        out->temp = NULL;
+        return -1;
+    }
+
+    // Reserve the blocks up front: a store into a hole the disk cannot fill
+    // raises SIGBUS, where the buffered path would report the error
+    void *data = MAP_FAILED;
+    if (posix_fallocate(out->fd, 0, (off_t)capacity) == 0) {
+        data = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, out->fd, 0);
+    }
+    if (data == MAP_FAILED) {
+        mapped_output_abort(out);
+        return -1;
+    }
+    out->data = data;
+    out->capacity = capacity;
+    return 0;
+}
+
+int mapped_output_commit(MappedOutput *out, size_t size, const char *filepath) {
+    munmap(out->data, out->capacity);
+    out->data = NULL;
+
+    int ok = size <= out->capacity && ftruncate(out->fd, (off_t)size) == 0;
+    if (close(out->fd) != 0) ok = 0;
+    out->fd = -1;
+    if (ok && rename(out->temp, filepath) != 0) ok = 0;
+    if (!ok) {
+        fprintf(stderr, "Error: Cannot write file '%s'\n", filepath);
+        unlink(out->temp);
+    }
+    free(out->temp);
+    out->temp = NULL;
+    return ok ? 0 : -1;
+}
+
+void mapped_output_abort(MappedOutput *out) {
+    if (out->data) munmap(out->data, out->capacity);
+    if (out->fd >= 0) close(out->fd);
+    if (out->temp) {
+        unlink(out->temp);
+        free(out->temp);
+    }
+    memset(out, 0, sizeof(*out));
+    out->fd = -1;
+}
+#else
+int mapped_output_open(MappedOutput *out, const char *filepath, size_t capacity) {
+    (void)filepath;
+    (void)capacity;
+    memset(out, 0, sizeof(*out));
+    out->fd = -1;
+    return -1;
+}
+
+int mapped_output_commit(MappedOutput *out, size_t size, const char *filepath) {
+    (void)out;
+    (void)size;
+    (void)filepath;
+    return -1;
+}
+
+void mapped_output_abort(MappedOutput *out) {
+    (void)out;
+}
+#endif
+
+#ifdef __linux__
+int pipe_output_open(PipeOutput *out, int fd, const char *pinned, size_t pinned_size, size_t capacity) {
+    memset(out, 0, sizeof(*out));
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISFIFO(st.st_mode)) return -1;
+
+    out->iov = malloc(PIPE_IOVECS * sizeof(*out->iov));
+    out->staging = malloc(capacity ? capacity : 1);
+    if (!out->iov || !out->staging) {
+        free(out->iov);
+        free(out->staging);
+        return -1;
+    }
+    out->fd = fd;
+    out->pinned = pinned;
+    out->pinned_size = pinned_size;
+    out->capacity = capacity;
+
+    // Each spliced segment takes a pipe slot; the default pipe has 16
+    fcntl(fd, F_SETPIPE_SZ, 1024 * 1024);
+    return 0;
+}
+
+// Splice the queued segments, resuming after partial transfers
+static void pipe_output_flush(PipeOutput *out) {
+    struct iovec *iov = out->iov;
+    size_t count = out->count;
+    out->count = 0;
+
+    while (count > 0 && !out->failed) {
+        ssize_t n = out->copy ? writev(out->fd, iov, (int)count) : vmsplice(out->fd, iov, count, 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && !out->copy && (errno == EINVAL || errno == ENOSYS)) {
+            out->copy = 1;
+            continue;
+        }
+        if (n < 0) {
+            fprintf(stderr, "Error: Cannot write to output pipe\n");
+            out->failed = 1;
+            break;
+        }
+
+        size_t done = (size_t)n;
+        while (count > 0 && done >= iov->iov_len) {
+            done -= iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base = (char*)iov->iov_base + done;
+            iov->iov_len -= done;
+        }
+    }
+}
+
+static void pipe_output_queue(PipeOutput *out, const char *data, size_t length) {
+    if (out->count == PIPE_IOVECS) pipe_output_flush(out);
+    out->iov[out->count].iov_base = (void*)data;
+    out->iov[out->count].iov_len = length;
+    out->count++;
+}
+
+int pipe_output_write(void *context, const char *data, size_t length) {
+    PipeOutput *out = context;
+    if (length == 0 || out->failed) return out->failed;
+
+    // Only spans wholly inside the pinned input go by reference; anything
+    // else (a caller's heap buffer) is valid only during this call
+    if (length >= PIPE_SPLICE_MIN && out->pinned && data >= out->pinned &&
+        data < out->pinned + out->pinned_size &&
+        length <= out->pinned_size - (size_t)(data - out->pinned)) {
+        pipe_output_queue(out, data, length);
+        return out->failed;
+    }
+
+    if (length > out->capacity - out->staged) {
+        // Out of staging room: send what is queued, then copy this span
+        pipe_output_flush(out);
+        while (length > 0 && !out->failed) {
+            ssize_t n = write(out->fd, data, length);
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) {
+                fprintf(stderr, "Error: Cannot write to output pipe\n");
+                out->failed = 1;
+                break;
+            }
+            data += n;
+            length -= (size_t)n;
+        }
+        return out->failed;
+    }
+
+    // Adjacent copies share one segment
+    char *copy = out->staging + out->staged;
+    memcpy(copy, data, length);
+    out->staged += length;
+    struct iovec *last = out->count > 0 ? &out->iov[out->count - 1] : NULL;
+    if (last && (char*)last->iov_base + last->iov_len == copy) {
+        last->iov_len += length;
+    } else {
+        pipe_output_queue(out, copy, length);
+    }
+    return out->failed;
+}
+
+int pipe_output_close(PipeOutput *out) {
+    pipe_output_flush(out);
+    free(out->iov);
+    out->iov = NULL;
+    // The staging area is left allocated: the pipe may still reference it
+    return out->failed ? -1 : 0;
+}
+#else
+int pipe_output_open(PipeOutput *out, int fd, const char *pinned, size_t pinned_size, size_t capacity) {
+    (void)fd;
+    (void)pinned;
+    (void)pinned_size;
+    (void)capacity;
+    memset(out, 0, sizeof(*out));
+    return -1;
+}
+
+int pipe_output_write(void *context, const char *data, size_t length) {
+    (void)context;
+    (void)data;
+    (void)length;
+    return -1;
+}
+
+int pipe_output_close(PipeOutput *out) {
+    (void)out;
+    return -1;
+}
+#endif
+
+int make_parent_dirs(const char *filepath) {
+    char *path = strdup(filepath);
+    if (!path) return -1;
+
+    for (char *p = path + 1; *p; p++) {
+        if (*p != '/') continue;
+        *p = '\0';
+        if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+            fprintf(stderr, "Error: Cannot create directory '%s'\n", path);
+            free(path);
+            return -1;
+        }
+        *p = '/';
+    }
+
+    free(path);
+    return 0;
+}
+
+int is_regular_file(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 && S_ISREG(st.st_mode);
+}
+
+void write_json_string(FILE *file, const char *str, size_t length) {
+    fputc('"', file);
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = (unsigned char)str[i];
+        if (c == '"' || c == '\\') {
+            fprintf(file, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(file, "\\u%04x", c);
+        } else {
+            fputc(c, file);
+        }
+    }
+    fputc('"', file);
+}
@@ -0,0 +1,90 @@
+#ifndef IO_H
+#define IO_H
+
+#include <stddef.h>
+#include <stdio.h>
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
+
+#define MAX_FILE_SIZE 1024 * 1024  // 1MB max file size
+
+// Read a whole file into a NUL-terminated heap buffer
+char* read_file(const char *filepath, size_t *size);
+
+// Read all of stdin into a NUL-terminated heap buffer
+char* read_stdin(size_t *size);
+
+// Write content to filepath ("-" for stdout)
+int write_output(const char *filepath, const char *content);
+
+// Outputs of inputs at least this large are written through a mapping
+#define MAPPED_OUTPUT_MIN (64 * 1024)
+
+// Output file written in place through a shared mapping and published by rename
+typedef struct {
+    char *data;              // Writable mapping of capacity bytes
+    size_t capacity;
+    int fd;
+    char *temp;              // Temporary file beside the target
+} MappedOutput;
+
+// Create a temporary file beside filepath, allocate capacity bytes of disk
+// for it and map it. Returns -1 (nothing created) where mapping is
+// unavailable or the space cannot be reserved; use write_output() then.
+int mapped_output_open(MappedOutput *out, const char *filepath, size_t capacity);
+
+// Trim the file to size, unmap it and rename it to filepath (same directory
+// as the path given to mapped_output_open())
+int mapped_output_commit(MappedOutput *out, size_t size, const char *filepath);
+
+// Unmap and remove the temporary file
+void mapped_output_abort(MappedOutput *out);
+
+// Spans at least this long are handed to the pipe by reference; shorter
+// ones are cheaper to copy than to pin
+#define PIPE_SPLICE_MIN 1024
+
+// Segments gathered before each vmsplice() call
+#define PIPE_IOVECS 256
+
+// Output pushed into a pipe with vmsplice(): spans inside the pinned buffer
+// (the input) are moved by reference, everything else is copied into a
+// staging area that is never reused. The pipe can still reference both
+// after the last call, so they must stay untouched until the process exits.
+typedef struct {
+    int fd;
+    const char *pinned;
+    size_t pinned_size;
+    char *staging;           // Copies of short spans, capacity bytes
+    size_t capacity;
+    size_t staged;
+    struct iovec *iov;       // Segments not yet spliced
+    size_t count;
+    int copy;                // Pipe refused vmsplice(): writev() instead
+    int failed;
+} PipeOutput;
+
+// Set up for fd when it is a pipe, with room to stage capacity bytes
+// Returns -1 (use write_output()) for other files or where vmsplice() is unavailable
+int pipe_output_open(PipeOutput *out, int fd, const char *pinned, size_t pinned_size, size_t capacity);
+
+// Queue length bytes (an OutputSink); returns nonzero once writing failed
+int pipe_output_write(void *context, const char *data, size_t length);
+
+// Splice what is queued; returns -1 if any write failed. The staging area
+// is not freed and the pinned buffer must stay untouched, since the reader
+// may still be consuming their pages: each use leaks both, so it only suits
+// one output per process that exits right after (the single-file CLI).
+int pipe_output_close(PipeOutput *out);
+
+// Create every missing parent directory of filepath
+int make_parent_dirs(const char *filepath);
+
+// Check whether path names an existing regular file
+int is_regular_file(const char *path);
+
+// Write length bytes of str as a quoted, escaped JSON string
+void write_json_string(FILE *file, const char *str, size_t length);
+
+#endif // IO_H
@@ -1,29 +1,190 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
 #include "analyzer/analyzer.h"
-
-#define MAX_FILE_SIZE 1024 * 1024  // 1MB max file size
+#include "analyzer/arena.h"
+#include "analyzer/engine.h"
+#include "analyzer/input.h"
+#include "analyzer/tree.h"
+#include "io/io.h"
+#include "batch/batch.h"
+#include "tar/tar.h"
+#include "cache/remote.h"
 
 // Simple argument parser (cross-platform, no getopt dependency)
 typedef struct {
     char *file;
+    const char **files;      // Every -f given (batch mode when more than one)
+    size_t file_count;
     char *output;
+    char *deps;
+    char *export_index;
+    char *summary;
+    int top;
+    char *cache_dir;
+    char *cache_url;
+    int cache_timeout;
+    char *cache_serve;
+    char *manifest;
+    int hash_names;
     int use_stdin;
+    int crawl;
+    int tar;
+    DedupMode dedup;
+    BomMode bom;
+    int dump_tree;
+    HugePageMode hugepages;
+    int prefault;
+    int stats;
+    Engine engine;
+    double shadow_rate;
+    int jobserver;
+    int isolate;
+    int jobs;
     int show_help;
 } Args;
 
 int parse_args(int argc, char *argv[], Args *args) {
     args->file = NULL;
+    args->files = malloc(argc * sizeof(char*));
+    args->file_count = 0;
     args->output = NULL;
+    args->deps = NULL;
+    args->export_index = NULL;
+    args->summary = NULL;
+    args->top = SUMMARY_DEFAULT_TOP;
+    args->cache_dir = NULL;
+    args->cache_url = NULL;
+    args->cache_timeout = REMOTE_RACE;
+    args->cache_serve = NULL;
+    args->manifest = NULL;
+    args->hash_names = 0;
     args->use_stdin = 0;
+    args->crawl = 0;
+    args->tar = 0;
+    args->dedup = DEDUP_COPY;
+    args->bom = BOM_KEEP;
+    args->dump_tree = 0;
+    args->hugepages = HUGEPAGES_AUTO;
+    args->prefault = 1;
+    args->stats = 0;
+    args->engine = ENGINE_REFERENCE;
+    args->shadow_rate = 0.0;
+    args->jobserver = 1;
+    args->isolate = 0;
+    args->jobs = 0;
     args->show_help = 0;
 
+    if (!args->files) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+
     for (int i = 1; i < argc; i++) {
         if ((strcmp(argv[i], "-f") == 0 || strcmp(argv[i], "--file") == 0) && i + 1 < argc) {
             args->file = argv[++i];
+            args->files[args->file_count++] = args->file;
+        } else if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--jobs") == 0) && i + 1 < argc) {
+            args->jobs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--crawl") == 0) {
+            args->crawl = 1;
+        } else if (strcmp(argv[i], "--tar") == 0) {
+            args->tar = 1;
+        } else if (strcmp(argv[i], "--dedup") == 0 && i + 1 < argc) {
+            const char *mode = argv[++i];
+            if (strcmp(mode, "off") == 0) {
+                args->dedup = DEDUP_OFF;
+            } else if (strcmp(mode, "copy") == 0) {
+                args->dedup = DEDUP_COPY;
+            } else if (strcmp(mode, "link") == 0) {
+                args->dedup = DEDUP_LINK;
+            } else if (strcmp(mode, "reflink") == 0) {
+                args->dedup = DEDUP_REFLINK;
+            } else {
+                fprintf(stderr, "Unknown dedup mode: %s\n", mode);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--bom") == 0 && i + 1 < argc) {
+            if (bom_mode_from_name(argv[++i], &args->bom) != 0) {
+                fprintf(stderr, "Unknown BOM mode: %s\n", argv[i]);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--hugepages") == 0 && i + 1 < argc) {
+            const char *mode = argv[++i];
+            if (strcmp(mode, "off") == 0) {
+                args->hugepages = HUGEPAGES_OFF;
+            } else if (strcmp(mode, "auto") == 0) {
+                args->hugepages = HUGEPAGES_AUTO;
+            } else if (strcmp(mode, "always") == 0) {
+                args->hugepages = HUGEPAGES_ALWAYS;
+            } else {
+                fprintf(stderr, "Unknown hugepages mode: %s\n", mode);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--no-prefault") == 0) {
+            args->prefault = 0;
+        } else if (strcmp(argv[i], "--engine") == 0 && i + 1 < argc) {
+            if (engine_from_name(argv[++i], &args->engine) != 0) {
+                fprintf(stderr, "Unknown engine: %s\n", argv[i]);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--shadow") == 0 && i + 1 < argc) {
+            char *end;
+            args->shadow_rate = strtod(argv[++i], &end);
+            if (*end != '\0' || args->shadow_rate < 0 || args->shadow_rate > 1) {
+                fprintf(stderr, "Invalid shadow rate: %s (expected 0 to 1)\n", argv[i]);
+                return -1;
+            }
+        } else if (strcmp(argv[i], "--isolate") == 0) {
+            args->isolate = 1;
+        } else if (strcmp(argv[i], "--no-jobserver") == 0) {
+            args->jobserver = 0;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            args->stats = 1;
+        } else if (strcmp(argv[i], "--dump-tree") == 0) {
+            args->dump_tree = 1;
         } else if ((strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--output") == 0) && i + 1 < argc) {
             args->output = argv[++i];
+        } else if (strcmp(argv[i], "--deps") == 0 && i + 1 < argc) {
+            args->deps = argv[++i];
+        } else if (strcmp(argv[i], "--export-index") == 0 && i + 1 < argc) {
+            args->export_index = argv[++i];
+        } else if (strcmp(argv[i], "--summary") == 0 && i + 1 < argc) {
+            args->summary = argv[++i];
+        } else if (strcmp(argv[i], "--cache-dir") == 0 && i + 1 < argc) {
+            args->cache_dir = argv[++i];
+        } else if (strcmp(argv[i], "--cache-url") == 0 && i + 1 < argc) {
+            args->cache_url = argv[++i];
+        } else if (strcmp(argv[i], "--cache-timeout") == 0 && i + 1 < argc) {
+            if (strcmp(argv[++i], "race") == 0) {
+                args->cache_timeout = REMOTE_RACE;
+            } else {
+                char *end;
+                long timeout = strtol(argv[i], &end, 10);
+                if (*end != '\0' || end == argv[i] || timeout < 0 || timeout > 3600000) {
+                    fprintf(stderr, "Invalid --cache-timeout: %s (expected milliseconds or race)\n", argv[i]);
+                    return -1;
+                }
+                args->cache_timeout = (int)timeout;
+            }
+        } else if (strcmp(argv[i], "--cache-serve") == 0 && i + 1 < argc) {
+            args->cache_serve = argv[++i];
+        } else if (strcmp(argv[i], "--manifest") == 0 && i + 1 < argc) {
+            args->manifest = argv[++i];
+        } else if (strcmp(argv[i], "--hash-names") == 0) {
+            args->hash_names = 1;
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            args->top = atoi(argv[++i]);
+            if (args->top < 0) {
+                fprintf(stderr, "Invalid --top count: %s\n", argv[i]);
+                return -1;
+            }
         } else if (strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--stdin") == 0) {
             args->use_stdin = 1;
         } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
@@ -43,118 +204,238 @@ void print_usage(const char *program_name) {
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -f, --file FILE      Path to the TypeScript file to process\n");
     fprintf(stderr, "  -o, --output FILE    Path to write the output (defaults to same as input)\n");
+    fprintf(stderr, "                       In batch mode, directory that mirrors the inputs\n");
     fprintf(stderr, "  -s, --stdin          Read code from stdin instead of file\n");
+    fprintf(stderr, "  --deps FILE          Write module dependencies as JSON (- for stdout)\n");
+    fprintf(stderr, "  --export-index FILE  Write a binary index of every module's exports (batch mode)\n");
+    fprintf(stderr, "  --summary FILE       Write a run summary: totals, stage times, slowest and largest\n");
+    fprintf(stderr, "                       files (JSON when FILE ends in .json, - for stdout)\n");
+    fprintf(stderr, "  --top N              Files listed in each summary ranking (default: %d)\n", SUMMARY_DEFAULT_TOP);
+    fprintf(stderr, "  --hash-names         Batch mode: name outputs name.<content hash>.ext\n");
+    fprintf(stderr, "  --manifest FILE      Batch mode: map source paths to output paths (JSON when FILE\n");
+    fprintf(stderr, "                       ends in .json, binary otherwise)\n");
+    fprintf(stderr, "  --crawl              Treat -f files as entry points and strip every file\n");
+    fprintf(stderr, "                       reachable through relative imports\n");
+    fprintf(stderr, "  --dump-tree          Print the declaration/statement tree instead of stripping\n");
+    fprintf(stderr, "  --dedup MODE         Strip identical inputs once: off, copy (default), link, reflink\n");
+    fprintf(stderr, "  --bom MODE           Leading UTF-8 byte order mark: keep (default) or strip\n");
+    fprintf(stderr, "  --cache-dir DIR      Batch/tar mode: reuse edit plans (removed ranges) cached by content hash\n");
+    fprintf(stderr, "  --cache-url URL      Batch/tar mode: share edit plans through an HTTP cache (http://host[:port][/prefix])\n");
+    fprintf(stderr, "  --cache-timeout MS   Wait limit per remote lookup, or race (default): no longer than stripping locally\n");
+    fprintf(stderr, "  --cache-serve ADDR   Serve --cache-dir over HTTP on [host:]port (until interrupted)\n");
+    fprintf(stderr, "  -j, --jobs N         Worker threads for batch/crawl mode (default: adapts to CPU quota and I/O)\n");
+    fprintf(stderr, "  --engine NAME        Stripping engine: reference (default), fast, structural, threaded, auto\n");
+    fprintf(stderr, "  --shadow RATE        Also run this fraction of inputs on a second engine and compare\n");
+    fprintf(stderr, "  --tar                Strip .ts members of a tar stream (stdin or -f) into a tar stream (stdout or -o)\n");
+    fprintf(stderr, "  --isolate            Batch mode: strip in worker processes so a crash fails one file\n");
+    fprintf(stderr, "  --no-jobserver       Ignore a make jobserver advertised in MAKEFLAGS\n");
+    fprintf(stderr, "  --hugepages MODE     Large buffers: off, auto (2 MB+, default), always (64 KB+)\n");
+    fprintf(stderr, "  --no-prefault        Do not populate large buffers up front\n");
+    fprintf(stderr, "  --stats              Print timing, page fault and allocation stats to stderr\n");
     fprintf(stderr, "  -h, --help           Display this help message\n");
 }
 
-char* read_file(const char *filepath, size_t *size) {
-    FILE *file = fopen(filepath, "r");
+int write_deps(const char *filepath, const ModuleDep *deps, size_t dep_count) {
+    FILE *file = strcmp(filepath, "-") == 0 ? stdout : fopen(filepath, "w");
     if (!file) {
-        fprintf(stderr, "Error: Cannot open file '%s'\n", filepath);
-        return NULL;
+        fprintf(stderr, "Error: Cannot open file '%s' for writing\n", filepath);
+        return -1;
     }
 
-    fseek(file, 0, SEEK_END);
-    *size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-
-    if (*size > MAX_FILE_SIZE) {
-        fprintf(stderr, "Error: File too large (max %d bytes)\n", MAX_FILE_SIZE);
-        fclose(file);
-        return NULL;
+    fprintf(file, "[");
+    for (size_t i = 0; i < dep_count; i++) {
+        const ModuleDep *dep = &deps[i];
+        fprintf(file, "%s\n  {\"kind\": \"%s\", \"specifier\": ", i ? "," : "", dep_kind_name(dep->kind));
+        write_json_string(file, dep->specifier, dep->length);
+        fprintf(file, ", \"typeOnly\": %s, \"start\": %zu, \"end\": %zu, \"line\": %d}",
+                dep->type_only ? "true" : "false", dep->start, dep->end, dep->line);
     }
+    fprintf(file, "%s]\n", dep_count ? "\n" : "");
 
-    char *content = malloc(*size + 1);
-    if (!content) {
-        fprintf(stderr, "Error: Memory allocation failed\n");
+    if (file != stdout) {
         fclose(file);
-        return NULL;
     }
+    return 0;
+}
 
-    size_t read_size = fread(content, 1, *size, file);
-    content[read_size] = '\0';
-    *size = read_size;
+int dump_tree(const char *code, size_t size) {
+    AST *ast = engine_lex(engine_selected(), code, size);
+    SyntaxTree *tree = ast ? tree_build(ast, code) : NULL;
+    if (!tree) {
+        fprintf(stderr, "Error: Cannot build syntax tree\n");
+        ast_free(ast);
+        return 1;
+    }
 
-    fclose(file);
-    return content;
+    tree_dump(tree, stdout);
+    tree_free(tree);
+    ast_free(ast);
+    return 0;
 }
 
-char* read_stdin(size_t *size) {
-    size_t capacity = 4096;
-    size_t length = 0;
-    char *content = malloc(capacity);
-    
-    if (!content) {
+// Start collecting a summary when --summary was given
+Summary* summary_start(const Args *args, Summary *summary) {
+    if (!args->summary) return NULL;
+    if (summary_init(summary, args->top) != 0) {
         fprintf(stderr, "Error: Memory allocation failed\n");
         return NULL;
     }
+    summary->wall_ms = summary_now_ms();
+    return summary;
+}
 
-    size_t chunk_size;
-    while ((chunk_size = fread(content + length, 1, capacity - length, stdin)) > 0) {
-        length += chunk_size;
-        if (length >= capacity - 1) {
-            capacity *= 2;
-            if (capacity > MAX_FILE_SIZE) {
-                fprintf(stderr, "Error: Input too large (max %d bytes)\n", MAX_FILE_SIZE);
-                free(content);
-                return NULL;
-            }
-            char *new_content = realloc(content, capacity);
-            if (!new_content) {
-                fprintf(stderr, "Error: Memory reallocation failed\n");
-                free(content);
-                return NULL;
-            }
-            content = new_content;
-        }
-    }
+int summary_finish(Summary *summary, const char *filepath) {
+    if (!summary) return 0;
+    summary->wall_ms = summary_now_ms() - summary->wall_ms;
+    int status = summary_write(summary, filepath);
+    summary_free(summary);
+    return status;
+}
 
-    content[length] = '\0';
-    *size = length;
-    return content;
+// Open the --cache-url remote; 0 when none is configured, -1 on a bad URL
+int remote_start(const Args *args, RemoteCache **remote) {
+    *remote = NULL;
+    if (!args->cache_url) return 0;
+    *remote = remote_open(args->cache_url, args->cache_timeout);
+    return *remote ? 0 : -1;
 }
 
-int write_output(const char *filepath, const char *content) {
-    if (strcmp(filepath, "-") == 0) {
-        // Write to stdout
-        printf("%s", content);
-        return 0;
+// Flush uploads and close the remote, reporting its counters with --stats
+void remote_finish(const Args *args, RemoteCache *remote) {
+    if (!remote) return;
+    RemoteStats stats;
+    remote_close(remote, &stats);
+    if (args->stats) {
+        fprintf(stderr, "Remote cache: %zu lookup(s), %zu hit(s), %zu late, %zu skipped, %zu error(s), "
+                "%zu upload(s), %.2f ms round trip\n", stats.lookups, stats.hits, stats.late,
+                stats.skipped, stats.errors, stats.uploads, stats.rtt_ms);
     }
+}
 
-    FILE *file = fopen(filepath, "w");
-    if (!file) {
-        fprintf(stderr, "Error: Cannot open file '%s' for writing\n", filepath);
-        return -1;
+int run_batch(const Args *args) {
+    if (args->use_stdin || args->deps) {
+        fprintf(stderr, "Error: -s/--stdin and --deps are not supported in batch mode\n");
+        return 1;
     }
 
-    fprintf(file, "%s", content);
-    fclose(file);
-    return 0;
+    BatchOptions options;
+    options.inputs = args->files;
+    options.input_count = args->file_count;
+    options.output_dir = args->output;
+    options.jobs = args->jobs;
+    options.crawl = args->crawl;
+    options.export_index = args->export_index;
+    options.dedup = args->dedup;
+    options.jobserver = args->jobserver;
+    options.isolate = args->isolate;
+    options.cache_dir = args->cache_dir;
+    options.hash_names = args->hash_names;
+    options.manifest = args->manifest;
+    options.bom = args->bom;
+    if (remote_start(args, &options.remote) != 0) return 1;
+
+    Summary summary;
+    options.summary = summary_start(args, &summary);
+
+    BatchStats stats;
+    int result_code = batch_run(&options, &stats);
+    remote_finish(args, options.remote);
+    if (summary_finish(options.summary, args->summary) != 0) result_code = -1;
+
+    printf("Type stripping complete. %zu file(s) processed (%zu duplicate), %zu failed\n",
+           stats.files, stats.duplicates, stats.failed);
+    if (args->stats) {
+        fprintf(stderr, "Workers: %d CPU-bound, up to %d at once (job CPU utilization %.0f%%)\n",
+                stats.cpu_workers, stats.peak_workers, stats.utilization * 100);
+        if (args->isolate) {
+            fprintf(stderr, "Worker processes restarted: %zu\n", stats.restarts);
+        }
+        if (stats.jobserver) {
+            fprintf(stderr, "Jobserver: %zu token(s) acquired\n", stats.tokens);
+        }
+        if (args->cache_dir || args->cache_url) {
+            fprintf(stderr, "Edit-plan cache: %zu hit(s), %zu miss(es)\n", stats.cache_hits, stats.cache_misses);
+        }
+    }
+    return result_code == 0 ? 0 : 1;
 }
 
-int main(int argc, char *argv[]) {
-    Args args;
-    
-    if (parse_args(argc, argv, &args) != 0) {
-        print_usage(argv[0]);
+int run_tar(const Args *args) {
+    if (args->file_count > 1 || args->crawl || args->export_index || args->deps || args->isolate ||
+        args->hash_names || args->manifest) {
+        fprintf(stderr, "Error: --tar takes one archive and no batch options\n");
+        return 1;
+    }
+    int archive_on_stdout = !args->output || strcmp(args->output, "-") == 0;
+    if (args->summary && strcmp(args->summary, "-") == 0 && archive_on_stdout) {
+        fprintf(stderr, "Error: Cannot write both the archive and --summary to stdout\n");
         return 1;
     }
 
-    if (args.show_help) {
-        print_usage(argv[0]);
-        return 0;
+    int input_fd = STDIN_FILENO;
+    int output_fd = STDOUT_FILENO;
+    if (args->file && strcmp(args->file, "-") != 0) {
+        input_fd = open(args->file, O_RDONLY);
+        if (input_fd < 0) {
+            fprintf(stderr, "Error: Cannot open file '%s'\n", args->file);
+            return 1;
+        }
+    }
+    if (!archive_on_stdout) {
+        output_fd = open(args->output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (output_fd < 0) {
+            fprintf(stderr, "Error: Cannot open file '%s' for writing\n", args->output);
+            if (input_fd != STDIN_FILENO) close(input_fd);
+            return 1;
+        }
     }
 
+    TarOptions options;
+    options.input_fd = input_fd;
+    options.output_fd = output_fd;
+    options.jobs = args->jobs;
+    options.jobserver = args->jobserver;
+    options.cache_dir = args->cache_dir;
+    options.bom = args->bom;
+    if (remote_start(args, &options.remote) != 0) {
+        if (input_fd != STDIN_FILENO) close(input_fd);
+        if (output_fd != STDOUT_FILENO) close(output_fd);
+        return 1;
+    }
+
+    Summary summary;
+    options.summary = summary_start(args, &summary);
+
+    TarStats stats;
+    int result_code = tar_run(&options, &stats);
+    remote_finish(args, options.remote);
+    if (summary_finish(options.summary, args->summary) != 0) result_code = -1;
+
+    if (input_fd != STDIN_FILENO) close(input_fd);
+    if (output_fd != STDOUT_FILENO && close(output_fd) != 0) result_code = -1;
+
+    // stdout may carry the archive, so the summary goes to stderr
+    fprintf(stderr, "Tar stripping complete. %zu member(s): %zu stripped, %zu passed through, %zu failed\n",
+            stats.entries, stats.stripped, stats.passed, stats.failed);
+    return result_code == 0 ? 0 : 1;
+}
+
+int run_single(const Args *args, const char *program_name) {
     // Validate input options
-    if (!args.use_stdin && !args.file) {
+    if (!args->use_stdin && !args->file) {
         fprintf(stderr, "Error: Must specify either -f/--file or -s/--stdin\n\n");
-        print_usage(argv[0]);
+        print_usage(program_name);
         return 1;
     }
 
-    char *input_file = args.file;
-    char *output_file = args.output;
-    int use_stdin = args.use_stdin;
+    if (args->summary) {
+        fprintf(stderr, "Error: --summary needs batch mode (several -f, --crawl or --export-index) or --tar\n");
+        return 1;
+    }
+
+    char *input_file = args->file;
+    char *output_file = args->output;
+    int use_stdin = args->use_stdin;
 
     // Read input
     size_t input_size = 0;
@@ -176,22 +457,173 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
-    // Strip TypeScript types
-    char *result = strip_types(code, input_size);
-    free(code);
+    // Reject invalid UTF-8 up front; a dropped BOM is skipped, not copied
+    InputScan scan;
+    if (input_check(use_stdin ? "<stdin>" : input_file, code, input_size, args->bom, &scan) != 0) {
+        free(code);
+        return 1;
+    }
+    const char *text = code + scan.skip;
+    input_size -= scan.skip;
+
+    if (args->dump_tree) {
+        int result_code = dump_tree(text, input_size);
+        free(code);
+        return result_code;
+    }
+
+    if (args->deps && strcmp(args->deps, "-") == 0 && strcmp(output_file, "-") == 0) {
+        fprintf(stderr, "Error: Cannot write both output and --deps to stdout\n");
+        free(code);
+        return 1;
+    }
+
+    // Pipes on stdout get the output spans by reference through vmsplice().
+    // The pipe may hold pages of the input and the staging area after we
+    // return, so neither is freed here; that is only fine because the
+    // process exits next (see pipe_output_close()).
+    PipeOutput piped;
+    if (strcmp(output_file, "-") == 0 && !args->deps &&
+        pipe_output_open(&piped, STDOUT_FILENO, text, input_size, input_size + 1) == 0) {
+        int status = scan.plain ? pipe_output_write(&piped, text, input_size)
+                                : engine_strip_sink(text, input_size, pipe_output_write, &piped);
+        if (status != 0 && !piped.failed) {
+            fprintf(stderr, "Error: Type stripping failed\n");
+        }
+        return pipe_output_close(&piped) == 0 && status == 0 ? 0 : 1;
+    }
+
+    // Large files are stripped straight into a mapped file renamed into place
+    MappedOutput mapped;
+    int is_mapped = input_size >= MAPPED_OUTPUT_MIN && strcmp(output_file, "-") != 0 &&
+                    mapped_output_open(&mapped, output_file, input_size + 1) == 0;
+
+    // Strip TypeScript types (collecting dependencies from the same pass)
+    AST *ast = NULL;
+    char *result = NULL;
+    size_t result_size = 0;
+    if (scan.plain && !args->deps) {
+        // Nothing to strip: the output is the input
+        result = is_mapped ? mapped.data : malloc(input_size + 1);
+        if (result) {
+            memcpy(result, text, input_size);
+            result[input_size] = '\0';
+            result_size = input_size;
+        }
+    } else if (is_mapped) {
+        result_size = engine_strip_into(text, input_size, mapped.data, args->deps ? &ast : NULL);
+        if (result_size != SIZE_MAX) result = mapped.data;
+    } else {
+        result = engine_strip(text, input_size, args->deps ? &ast : NULL);
+    }
 
     if (!result) {
         fprintf(stderr, "Error: Type stripping failed\n");
+        if (is_mapped) mapped_output_abort(&mapped);
+        ast_free(ast);
+        free(code);
         return 1;
     }
 
+    // Specifiers point into the input buffer, so write them before freeing it
+    if (args->deps && write_deps(args->deps, ast->deps, ast->dep_count) != 0) {
+        ast_free(ast);
+        if (is_mapped) mapped_output_abort(&mapped); else free(result);
+        free(code);
+        return 1;
+    }
+    ast_free(ast);
+    free(code);
+
     // Write output
-    int result_code = write_output(output_file, result);
-    free(result);
+    int result_code;
+    if (is_mapped) {
+        result_code = mapped_output_commit(&mapped, result_size, output_file);
+    } else {
+        result_code = write_output(output_file, result);
+        free(result);
+    }
 
-    if (result_code == 0 && strcmp(output_file, "-") != 0) {
+    // Keep stdout clean when it carries the dependency JSON
+    int deps_on_stdout = args->deps && strcmp(args->deps, "-") == 0;
+    if (result_code == 0 && strcmp(output_file, "-") != 0 && !deps_on_stdout) {
         printf("Type stripping complete. Output written to: %s\n", output_file);
     }
 
     return result_code == 0 ? 0 : 1;
 }
+
+void print_stats(const struct rusage *before, const struct timespec *start) {
+    struct rusage after;
+    struct timespec end;
+    getrusage(RUSAGE_SELF, &after);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    LargeAllocStats large;
+    large_alloc_stats(&large);
+
+    double elapsed_ms = (end.tv_sec - start->tv_sec) * 1e3 + (end.tv_nsec - start->tv_nsec) / 1e6;
+    fprintf(stderr, "Stats:\n");
+    fprintf(stderr, "  elapsed:            %.3f ms\n", elapsed_ms);
+    fprintf(stderr, "  page faults:        %ld minor, %ld major\n",
+            after.ru_minflt - before->ru_minflt, after.ru_majflt - before->ru_majflt);
+    fprintf(stderr, "  large allocations:  %zu (%zu aligned mappings, %zu KB mapped)\n",
+            large.allocations, large.mappings, large.mapped_bytes / 1024);
+    fprintf(stderr, "  huge page advice:   %zu KB\n", large.huge_bytes / 1024);
+    fprintf(stderr, "  prefaulted:         %zu KB\n", large.prefaulted_bytes / 1024);
+
+    EngineStats engine;
+    engine_stats(&engine);
+    fprintf(stderr, "  engine:             %s (%zu input(s))\n", engine_name(engine_selected()), engine.runs);
+    if (engine.shadow_runs) {
+        fprintf(stderr, "  shadow runs:        %zu, %zu mismatch(es), %.3f ms vs %.3f ms shadow (%.2fx)\n",
+                engine.shadow_runs, engine.mismatches, engine.primary_ms, engine.shadow_ms,
+                engine.primary_ms > 0 ? engine.shadow_ms / engine.primary_ms : 0.0);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    Args args;
+    
+    if (parse_args(argc, argv, &args) != 0) {
+        print_usage(argv[0]);
+        free(args.files);
+        return 1;
+    }
+
+    if (args.show_help) {
+        print_usage(argv[0]);
+        free(args.files);
+        return 0;
+    }
+
+    if (args.cache_serve) {
+        if (!args.cache_dir) {
+            fprintf(stderr, "Error: --cache-serve needs --cache-dir\n");
+            free(args.files);
+            return 1;
+        }
+        int serve_code = remote_serve(args.cache_serve, args.cache_dir) == 0 ? 0 : 1;
+        free(args.files);
+        return serve_code;
+    }
+
+    large_alloc_configure(args.hugepages, args.prefault);
+    engine_configure(args.engine, args.shadow_rate);
+
+    struct rusage usage;
+    struct timespec start;
+    getrusage(RUSAGE_SELF, &usage);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    int result_code = args.tar ? run_tar(&args)
+        : args.file_count > 1 || args.crawl || args.export_index || args.hash_names || args.manifest ? run_batch(&args)
+        : run_single(&args, argv[0]);
+
+    if (args.stats) {
+        print_stats(&usage, &start);
+    }
+
+    free(args.files);
+    return result_code;
+}
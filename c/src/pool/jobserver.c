@@ -0,0 +1,145 @@
+#define _GNU_SOURCE
+
+#include "jobserver.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+struct Jobserver {
+    int read_fd;
+    int write_fd;
+    int owns_read;   // read_fd was opened here (and is non-blocking)
+};
+
+// Find the value of the last occurrence of option in MAKEFLAGS; make appends
+// its own setting after any inherited one
+static const char* makeflags_option(const char *flags, const char *option, size_t *length) {
+    const char *found = NULL;
+    size_t option_length = strlen(option);
+
+    for (const char *p = strstr(flags, option); p; p = strstr(p + 1, option)) {
+        if (p == flags || p[-1] == ' ') {
+            found = p + option_length;
+        }
+    }
+    if (found) {
+        *length = strcspn(found, " ");
+    }
+    return found;
+}
+
+static int fd_is_open(int fd) {
+    return fd >= 0 && fcntl(fd, F_GETFD) != -1;
+}
+
+// The inherited pipe's file description is shared with make and its other
+// children, so it must not be switched to non-blocking in place. Reopening
+// it through /proc gives a private description of the same pipe.
+static int open_private(int fd, int *owned) {
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fd);
+    int reopened = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (reopened >= 0) {
+        *owned = 1;
+        return reopened;
+    }
+    *owned = 0;
+    return fd;
+}
+
+Jobserver* jobserver_from_env(void) {
+    const char *flags = getenv("MAKEFLAGS");
+    if (!flags) return NULL;
+
+    size_t length = 0;
+    const char *value = makeflags_option(flags, "--jobserver-auth=", &length);
+    if (!value) {
+        value = makeflags_option(flags, "--jobserver-fds=", &length);
+    }
+    if (!value || length == 0) return NULL;
+
+    Jobserver *js = calloc(1, sizeof(Jobserver));
+    if (!js) return NULL;
+
+    if (length > 5 && strncmp(value, "fifo:", 5) == 0) {
+        char *path = strndup(value + 5, length - 5);
+        if (path) {
+            js->read_fd = open(path, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+            free(path);
+        } else {
+            js->read_fd = -1;
+        }
+        if (js->read_fd < 0) {
+            free(js);
+            return NULL;
+        }
+        js->write_fd = js->read_fd;
+        js->owns_read = 1;
+        return js;
+    }
+
+    int read_fd = -1;
+    int write_fd = -1;
+    if (sscanf(value, "%d,%d", &read_fd, &write_fd) != 2 ||
+        !fd_is_open(read_fd) || !fd_is_open(write_fd)) {
+        // make did not pass the descriptors (recipe not marked with '+')
+        free(js);
+        return NULL;
+    }
+
+    js->read_fd = open_private(read_fd, &js->owns_read);
+    js->write_fd = write_fd;
+    return js;
+}
+
+int jobserver_acquire(Jobserver *js, char *token, int timeout_ms) {
+    struct pollfd pfd = { .fd = js->read_fd, .events = POLLIN };
+
+    for (;;) {
+        if (js->owns_read) {
+            // Private non-blocking description: just try to take a byte
+            ssize_t got = read(js->read_fd, token, 1);
+            if (got == 1) return 1;
+            if (got == 0) return -1;
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) return -1;
+        }
+
+        int ready = poll(&pfd, 1, timeout_ms);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (ready == 0) return 0;
+        if (pfd.revents & (POLLERR | POLLNVAL)) return -1;
+
+        if (!js->owns_read) {
+            // Shared blocking descriptor: another client may win the byte
+            // after poll; the read then blocks until the next token frees up
+            ssize_t got = read(js->read_fd, token, 1);
+            if (got == 1) return 1;
+            if (got == 0 || errno != EINTR) return -1;
+        }
+        // Only the first attempt waits; a lost race reports a timeout
+        timeout_ms = 0;
+    }
+}
+
+void jobserver_release(Jobserver *js, char token) {
+    while (write(js->write_fd, &token, 1) != 1) {
+        if (errno != EINTR) {
+            fprintf(stderr, "Error: Cannot return jobserver token\n");
+            return;
+        }
+    }
+}
+
+void jobserver_close(Jobserver *js) {
+    if (!js) return;
+    if (js->owns_read) close(js->read_fd);
+    free(js);
+}
@@ -0,0 +1,24 @@
+#ifndef JOBSERVER_H
+#define JOBSERVER_H
+
+// Client side of the GNU make jobserver. A recipe run by `make -jN` already
+// owns one implicit job slot; every additional concurrent job must read a
+// token byte from the jobserver and write the same byte back when done.
+typedef struct Jobserver Jobserver;
+
+// Connect to the jobserver advertised in MAKEFLAGS (--jobserver-auth=R,W,
+// --jobserver-auth=fifo:PATH or the older --jobserver-fds=R,W)
+// Returns NULL when there is none or its descriptors were not inherited
+Jobserver* jobserver_from_env(void);
+
+// Wait up to timeout_ms for a token
+// Returns 1 with the token byte stored, 0 on timeout, -1 if the jobserver broke
+int jobserver_acquire(Jobserver *js, char *token, int timeout_ms);
+
+// Give a token back to the jobserver
+void jobserver_release(Jobserver *js, char token);
+
+// Close the connection; every acquired token must have been released
+void jobserver_close(Jobserver *js);
+
+#endif // JOBSERVER_H
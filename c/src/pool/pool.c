@@ -0,0 +1,417 @@
+#define _GNU_SOURCE
+
+#include "pool.h"
+#include "jobserver.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+// Weight of the newest job in the smoothed utilization
+#define UTILIZATION_WEIGHT 0.2
+// Ignore jobs too short to time reliably (50 us)
+#define MIN_SAMPLE_NS 50000.0
+// How long a worker waits for a jobserver token before rechecking the queue
+#define TOKEN_POLL_MS 50
+
+// Job slot a worker holds while running jobs under a jobserver
+typedef enum {
+    SLOT_NONE,
+    SLOT_IMPLICIT,               // The one slot make granted this process
+    SLOT_TOKEN                   // A byte read from the jobserver
+} SlotKind;
+
+typedef struct PoolJob {
+    PoolJobFn fn;
+    void *arg;
+    struct PoolJob *next;
+} PoolJob;
+
+struct ThreadPool {
+    pthread_t *threads;
+    int worker_count;
+    int cpu_workers;
+    int active_limit;            // Workers allowed to run a job at once
+    int peak_limit;
+    int running;
+    double utilization;
+    size_t finished;
+
+    Jobserver *jobserver;        // NULL: no external limit
+    int jobserver_active;        // Cleared if the jobserver breaks
+    int implicit_busy;           // A worker holds the implicit slot
+    int acquiring;               // A worker is waiting for a token
+    size_t tokens;               // Tokens acquired so far
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;   // Signalled when a job is queued or on shutdown
+    pthread_cond_t idle;         // Signalled when outstanding drops to zero
+
+    PoolJob *head;
+    PoolJob *tail;
+    size_t outstanding;          // Queued plus running jobs
+    int shutdown;
+};
+
+static double clock_ns(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Fold one job's CPU/wall ratio into the running estimate and retune the
+// number of concurrently running jobs (caller holds the lock)
+static void pool_record(ThreadPool *pool, double cpu_ns, double wall_ns) {
+    pool->finished++;
+    if (pool->worker_count <= pool->cpu_workers || wall_ns < MIN_SAMPLE_NS) return;
+
+    double sample = cpu_ns / wall_ns;
+    if (sample > 1.0) sample = 1.0;
+    pool->utilization += UTILIZATION_WEIGHT * (sample - pool->utilization);
+
+    // Enough runners that their CPU share keeps cpu_workers cores busy
+    double wanted = pool->cpu_workers / (pool->utilization > 0.01 ? pool->utilization : 0.01);
+    int limit = (int)(wanted + 0.5);
+    if (limit < pool->cpu_workers) limit = pool->cpu_workers;
+    if (limit > pool->worker_count) limit = pool->worker_count;
+
+    if (limit > pool->active_limit) {
+        pthread_cond_broadcast(&pool->work_ready);
+    }
+    pool->active_limit = limit;
+    if (limit > pool->peak_limit) pool->peak_limit = limit;
+}
+
+// Return a worker's slot (caller holds the lock)
+static void pool_release_slot(ThreadPool *pool, SlotKind *slot, char token) {
+    if (*slot == SLOT_IMPLICIT) {
+        pool->implicit_busy = 0;
+    } else if (*slot == SLOT_TOKEN) {
+        jobserver_release(pool->jobserver, token);
+    }
+    *slot = SLOT_NONE;
+}
+
+// Get a slot to run the next job under, taking the implicit one if free;
+// returns 0 when the worker should re-evaluate the queue first (called with
+// the lock held; drops it while waiting for a token)
+static int pool_acquire_slot(ThreadPool *pool, SlotKind *slot, char *token) {
+    if (!pool->implicit_busy) {
+        pool->implicit_busy = 1;
+        *slot = SLOT_IMPLICIT;
+        return 1;
+    }
+
+    pool->acquiring = 1;
+    pthread_mutex_unlock(&pool->lock);
+    int got = jobserver_acquire(pool->jobserver, token, TOKEN_POLL_MS);
+    pthread_mutex_lock(&pool->lock);
+    pool->acquiring = 0;
+    pthread_cond_broadcast(&pool->work_ready);
+
+    if (got < 0) {
+        fprintf(stderr, "Error: Lost the make jobserver; continuing without it\n");
+        pool->jobserver_active = 0;
+        return 1;
+    }
+    if (got == 0) return 0;
+
+    *slot = SLOT_TOKEN;
+    pool->tokens++;
+    if (!pool->head || pool->running >= pool->active_limit) {
+        // The work went elsewhere while we waited
+        pool_release_slot(pool, slot, *token);
+        return 0;
+    }
+    return 1;
+}
+
+static void* pool_worker(void *arg) {
+    ThreadPool *pool = arg;
+    SlotKind slot = SLOT_NONE;
+    char token = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        // Without a slot, leave token waiting to a single worker
+        while ((!pool->head || pool->running >= pool->active_limit ||
+                (pool->jobserver_active && slot == SLOT_NONE &&
+                 pool->implicit_busy && pool->acquiring)) && !pool->shutdown) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if (!pool->head) break;  // Shutdown with an empty queue
+
+        if (pool->jobserver_active && slot == SLOT_NONE &&
+            !pool_acquire_slot(pool, &slot, &token)) {
+            continue;
+        }
+
+        PoolJob *job = pool->head;
+        pool->head = job->next;
+        if (!pool->head) pool->tail = NULL;
+        pool->running++;
+        pthread_mutex_unlock(&pool->lock);
+
+        double wall_start = clock_ns(CLOCK_MONOTONIC);
+        double cpu_start = clock_ns(CLOCK_THREAD_CPUTIME_ID);
+        job->fn(job->arg);
+        double cpu_ns = clock_ns(CLOCK_THREAD_CPUTIME_ID) - cpu_start;
+        double wall_ns = clock_ns(CLOCK_MONOTONIC) - wall_start;
+        free(job);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->running--;
+        pool_record(pool, cpu_ns, wall_ns);
+        if (pool->head) {
+            // A slot freed up; hand it to a waiting worker
+            pthread_cond_signal(&pool->work_ready);
+        }
+        if (!pool->head || pool->running >= pool->active_limit) {
+            // About to idle: give the job slot back so other build steps can use it
+            pool_release_slot(pool, &slot, token);
+        }
+        if (--pool->outstanding == 0) {
+            pthread_cond_broadcast(&pool->idle);
+        }
+    }
+    pool_release_slot(pool, &slot, token);
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+ThreadPool* pool_create(int workers) {
+    return pool_create_adaptive(workers, workers);
+}
+
+ThreadPool* pool_create_adaptive(int cpu_workers, int max_workers) {
+    if (cpu_workers < 1) cpu_workers = 1;
+    if (max_workers < cpu_workers) max_workers = cpu_workers;
+    int workers = max_workers;
+
+    ThreadPool *pool = calloc(1, sizeof(ThreadPool));
+    if (!pool) return NULL;
+
+    pool->threads = malloc(workers * sizeof(pthread_t));
+    if (!pool->threads) {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    for (int i = 0; i < workers; i++) {
+        if (pthread_create(&pool->threads[i], NULL, pool_worker, pool) != 0) break;
+        pool->worker_count++;
+    }
+
+    if (pool->worker_count == 0) {
+        pool_destroy(pool);
+        return NULL;
+    }
+
+    // Start by assuming CPU-bound jobs
+    pool->cpu_workers = cpu_workers < pool->worker_count ? cpu_workers : pool->worker_count;
+    pool->active_limit = pool->cpu_workers;
+    pool->peak_limit = pool->cpu_workers;
+    pool->utilization = 1.0;
+    return pool;
+}
+
+void pool_use_jobserver(ThreadPool *pool, Jobserver *jobserver) {
+    pthread_mutex_lock(&pool->lock);
+    pool->jobserver = jobserver;
+    pool->jobserver_active = jobserver != NULL;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+int pool_submit(ThreadPool *pool, PoolJobFn fn, void *arg) {
+    PoolJob *job = malloc(sizeof(PoolJob));
+    if (!job) return -1;
+
+    job->fn = fn;
+    job->arg = arg;
+    job->next = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->tail) {
+        pool->tail->next = job;
+    } else {
+        pool->head = job;
+    }
+    pool->tail = job;
+    pool->outstanding++;
+    pthread_cond_signal(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+    return 0;
+}
+
+void pool_wait(ThreadPool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->outstanding > 0) {
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void pool_destroy(ThreadPool *pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pool->active_limit = pool->worker_count;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->worker_count; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->idle);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+void pool_stats(ThreadPool *pool, PoolStats *stats) {
+    pthread_mutex_lock(&pool->lock);
+    stats->cpu_workers = pool->cpu_workers;
+    stats->max_workers = pool->worker_count;
+    stats->active_limit = pool->active_limit;
+    stats->peak_limit = pool->peak_limit;
+    stats->utilization = pool->utilization;
+    stats->jobs = pool->finished;
+    stats->tokens = pool->tokens;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// ============================================================================
+// CPU quota detection
+// ============================================================================
+
+#ifdef __linux__
+// Parse "quota period" (cpu.max uses "max" for no limit); returns CPUs or 0
+static double quota_cpus(const char *quota, const char *period) {
+    if (strncmp(quota, "max", 3) == 0) return 0;
+    double q = strtod(quota, NULL);
+    double p = strtod(period, NULL);
+    return q > 0 && p > 0 ? q / p : 0;
+}
+
+static int read_line(const char *path, char *buffer, size_t size) {
+    FILE *file = fopen(path, "r");
+    if (!file) return -1;
+    char *line = fgets(buffer, size, file);
+    fclose(file);
+    return line ? 0 : -1;
+}
+
+// cgroup v2: the tightest cpu.max from the process's cgroup up to the root
+static double cgroup2_cpus(const char *cgroup) {
+    char dir[4096];
+    snprintf(dir, sizeof(dir), "%s", cgroup);
+    double cpus = 0;
+
+    for (;;) {
+        char path[4200];
+        char line[128];
+        snprintf(path, sizeof(path), "/sys/fs/cgroup%s/cpu.max", strcmp(dir, "/") == 0 ? "" : dir);
+        if (read_line(path, line, sizeof(line)) == 0) {
+            char *period = strchr(line, ' ');
+            double limit = period ? quota_cpus(line, period + 1) : 0;
+            if (limit > 0 && (cpus == 0 || limit < cpus)) cpus = limit;
+        }
+
+        char *slash = strrchr(dir, '/');
+        if (!slash || slash == dir) {
+            if (strcmp(dir, "/") == 0) break;
+            strcpy(dir, "/");
+        } else {
+            *slash = '\0';
+        }
+    }
+    return cpus;
+}
+
+// cgroup v1: cfs_quota_us / cfs_period_us in the cpu controller's hierarchy
+static double cgroup1_cpus(const char *cgroup) {
+    static const char *mounts[] = { "/sys/fs/cgroup/cpu", "/sys/fs/cgroup/cpu,cpuacct" };
+    // Inside a container the hierarchy is usually mounted at the cgroup itself
+    const char *suffixes[] = { cgroup, "" };
+
+    for (size_t m = 0; m < sizeof(mounts) / sizeof(mounts[0]); m++) {
+        for (size_t s = 0; s < 2; s++) {
+            const char *suffix = strcmp(suffixes[s], "/") == 0 ? "" : suffixes[s];
+            char path[4200];
+            char quota[64];
+            char period[64];
+            snprintf(path, sizeof(path), "%s%s/cpu.cfs_quota_us", mounts[m], suffix);
+            if (read_line(path, quota, sizeof(quota)) != 0) continue;
+            snprintf(path, sizeof(path), "%s%s/cpu.cfs_period_us", mounts[m], suffix);
+            if (read_line(path, period, sizeof(period)) != 0) continue;
+            return quota[0] == '-' ? 0 : quota_cpus(quota, period);
+        }
+    }
+    return 0;
+}
+
+// CPU quota of this process's cgroup, 0 when unlimited or unknown
+static double cgroup_cpus(void) {
+    FILE *file = fopen("/proc/self/cgroup", "r");
+    if (!file) return 0;
+
+    char line[4096];
+    double cpus = 0;
+    while (!cpus && fgets(line, sizeof(line), file)) {
+        // hierarchy-id:controller-list:path
+        char *controllers = strchr(line, ':');
+        char *path = controllers ? strchr(controllers + 1, ':') : NULL;
+        if (!path) continue;
+        *path++ = '\0';
+        controllers++;
+        path[strcspn(path, "\n")] = '\0';
+
+        if (*controllers == '\0') {
+            cpus = cgroup2_cpus(path);
+            continue;
+        }
+        char *save = NULL;
+        for (char *name = strtok_r(controllers, ",", &save); name; name = strtok_r(NULL, ",", &save)) {
+            if (strcmp(name, "cpu") == 0) {
+                cpus = cgroup1_cpus(path);
+                break;
+            }
+        }
+    }
+    fclose(file);
+    return cpus;
+}
+#endif
+
+int pool_default_workers(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 1) cpus = 1;
+
+#ifdef __linux__
+    cpu_set_t mask;
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        int allowed = CPU_COUNT(&mask);
+        if (allowed > 0 && allowed < cpus) cpus = allowed;
+    }
+
+    double quota = cgroup_cpus();
+    if (quota > 0) {
+        long limit = (long)quota;
+        if (limit < quota) limit++;  // A partial CPU still deserves a worker
+        if (limit < cpus) cpus = limit;
+    }
+#endif
+    return (int)cpus;
+}
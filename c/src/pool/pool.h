@@ -0,0 +1,54 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+#include "jobserver.h"
+
+// Job function run on a worker thread
+typedef void (*PoolJobFn)(void *arg);
+
+// Worker thread pool with a FIFO job queue
+typedef struct ThreadPool ThreadPool;
+
+// Snapshot of the pool's concurrency tuning
+typedef struct {
+    int cpu_workers;         // Jobs allowed to run when they are CPU-bound
+    int max_workers;         // Threads started (upper bound for I/O-bound jobs)
+    int active_limit;        // Jobs currently allowed to run at once
+    int peak_limit;          // Highest active_limit reached
+    double utilization;      // Smoothed CPU time / wall time of finished jobs
+    size_t jobs;             // Jobs finished
+    size_t tokens;           // Jobserver tokens acquired
+} PoolStats;
+
+// Start a pool with the given number of worker threads
+ThreadPool* pool_create(int workers);
+
+// Start max_workers threads but run only cpu_workers jobs at once while jobs
+// are CPU-bound; the limit rises towards max_workers as jobs spend more of
+// their time blocked on I/O (limit = cpu_workers / utilization)
+ThreadPool* pool_create_adaptive(int cpu_workers, int max_workers);
+
+// Limit concurrent jobs by a make jobserver: one job runs on the slot make
+// granted this process and each additional one holds a token, returned as
+// soon as its worker finds the queue empty. Call before submitting jobs;
+// the pool does not take ownership.
+void pool_use_jobserver(ThreadPool *pool, Jobserver *jobserver);
+
+// Queue a job; safe to call from inside a running job
+int pool_submit(ThreadPool *pool, PoolJobFn fn, void *arg);
+
+// Block until the queue is empty and no job is running
+void pool_wait(ThreadPool *pool);
+
+// Stop the workers (after draining queued jobs) and free the pool
+void pool_destroy(ThreadPool *pool);
+
+// Fill in the pool's current tuning state
+void pool_stats(ThreadPool *pool, PoolStats *stats);
+
+// CPUs this process may actually use: the smaller of the affinity mask and
+// the cgroup CPU quota (v2 cpu.max or v1 cfs_quota_us), rounded up
+int pool_default_workers(void);
+
+#endif // POOL_H
@@ -0,0 +1,213 @@
+// CPython extension: the stripper in-process, without spawning ast-analyzer
+//
+//   strip(data, engine="reference") -> bytes
+//   strip_many(items, engine="reference", jobs=0) -> list of bytes
+//
+// Inputs are str (stripped as UTF-8) or any contiguous buffer (bytes,
+// bytearray, memoryview, mmap), read in place. Stripping runs with the
+// GIL released; strip_many() spreads its items over a worker pool.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "../analyzer/analyzer.h"
+#include "../analyzer/engine.h"
+#include "../pool/pool.h"
+#include <stdint.h>
+#include <string.h>
+
+// One input and the bytes object its output is written into
+typedef struct {
+    Py_buffer view;          // Held while stripping (view.obj NULL for str)
+    const char *source;
+    size_t size;
+    PyObject *output;        // size + 1 bytes, trimmed afterwards
+    size_t length;           // Output length, SIZE_MAX on failure
+    Engine engine;
+} StripItem;
+
+// Borrow item's bytes: str as its cached UTF-8 form, anything else
+// through the buffer protocol
+static int item_open(StripItem *item, PyObject *object, Engine engine) {
+    memset(item, 0, sizeof(*item));
+    item->engine = engine;
+    item->length = SIZE_MAX;
+
+    if (PyUnicode_Check(object)) {
+        Py_ssize_t size;
+        item->source = PyUnicode_AsUTF8AndSize(object, &size);
+        if (!item->source) return -1;
+        item->size = (size_t)size;
+    } else {
+        if (PyObject_GetBuffer(object, &item->view, PyBUF_SIMPLE) != 0) return -1;
+        item->source = item->view.buf;
+        item->size = (size_t)item->view.len;
+    }
+
+    // Stripping never lengthens the text
+    item->output = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)item->size + 1);
+    if (!item->output) {
+        if (item->view.obj) PyBuffer_Release(&item->view);
+        return -1;
+    }
+    return 0;
+}
+
+// Runs without the GIL: only touches the borrowed input and the output
+// storage of a bytes object nobody else has seen yet
+static void item_strip(void *arg) {
+    StripItem *item = arg;
+    char *out = PyBytes_AS_STRING(item->output);
+    if (item->size == 0) {
+        out[0] = '\0';
+        item->length = 0;
+        return;
+    }
+
+    AST *ast = engine_lex(item->engine, item->source, item->size);
+    if (!ast) return;
+    item->length = engine_parse_into(item->engine, ast, item->source, out);
+    ast_free(ast);
+}
+
+// Release the input and hand over the trimmed output (NULL on failure)
+static PyObject* item_close(StripItem *item) {
+    if (item->view.obj) PyBuffer_Release(&item->view);
+
+    PyObject *output = item->output;
+    item->output = NULL;
+    if (!output) return NULL;
+    if (item->length == SIZE_MAX) {
+        Py_DECREF(output);
+        PyErr_SetString(PyExc_RuntimeError, "type stripping failed");
+        return NULL;
+    }
+    if (_PyBytes_Resize(&output, (Py_ssize_t)item->length) != 0) return NULL;
+    return output;
+}
+
+// Drop an item whose output is not wanted (another item failed)
+static void item_discard(StripItem *item) {
+    if (item->view.obj) PyBuffer_Release(&item->view);
+    Py_CLEAR(item->output);
+}
+
+static int parse_engine(const char *name, Engine *engine) {
+    if (!name) {
+        *engine = ENGINE_REFERENCE;
+        return 0;
+    }
+    if (engine_from_name(name, engine) != 0) {
+        PyErr_Format(PyExc_ValueError, "unknown engine: %s", name);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject* py_strip(PyObject *self, PyObject *args, PyObject *kwargs) {
+    (void)self;
+    static char *keywords[] = { "data", "engine", NULL };
+    PyObject *data;
+    const char *engine_name = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|z:strip", keywords, &data, &engine_name)) {
+        return NULL;
+    }
+
+    Engine engine;
+    if (parse_engine(engine_name, &engine) != 0) return NULL;
+
+    StripItem item;
+    if (item_open(&item, data, engine) != 0) return NULL;
+
+    Py_BEGIN_ALLOW_THREADS
+    item_strip(&item);
+    Py_END_ALLOW_THREADS
+
+    return item_close(&item);
+}
+
+static PyObject* py_strip_many(PyObject *self, PyObject *args, PyObject *kwargs) {
+    (void)self;
+    static char *keywords[] = { "items", "engine", "jobs", NULL };
+    PyObject *items;
+    const char *engine_name = NULL;
+    int jobs = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|zi:strip_many", keywords,
+                                     &items, &engine_name, &jobs)) {
+        return NULL;
+    }
+
+    Engine engine;
+    if (parse_engine(engine_name, &engine) != 0) return NULL;
+
+    PyObject *sequence = PySequence_Fast(items, "strip_many() expects a sequence");
+    if (!sequence) return NULL;
+    Py_ssize_t count = PySequence_Fast_GET_SIZE(sequence);
+
+    StripItem *work = PyMem_Calloc(count > 0 ? (size_t)count : 1, sizeof(StripItem));
+    if (!work) {
+        Py_DECREF(sequence);
+        return PyErr_NoMemory();
+    }
+
+    Py_ssize_t opened = 0;
+    for (; opened < count; opened++) {
+        if (item_open(&work[opened], PySequence_Fast_GET_ITEM(sequence, opened), engine) != 0) break;
+    }
+
+    int failed = opened < count;
+    if (!failed) {
+        int workers = jobs > 0 ? jobs : pool_default_workers();
+        if (workers > count) workers = (int)count;
+
+        Py_BEGIN_ALLOW_THREADS
+        ThreadPool *pool = workers > 1 ? pool_create(workers) : NULL;
+        for (Py_ssize_t i = 0; i < count; i++) {
+            // Without a pool (one worker, or none could start) strip inline
+            if (!pool || pool_submit(pool, item_strip, &work[i]) != 0) item_strip(&work[i]);
+        }
+        if (pool) {
+            pool_wait(pool);
+            pool_destroy(pool);
+        }
+        Py_END_ALLOW_THREADS
+    }
+
+    PyObject *result = failed ? NULL : PyList_New(count);
+    for (Py_ssize_t i = 0; i < opened; i++) {
+        if (!result) {
+            item_discard(&work[i]);
+            continue;
+        }
+        PyObject *output = item_close(&work[i]);
+        if (output) {
+            PyList_SET_ITEM(result, i, output);
+        } else {
+            Py_CLEAR(result);
+        }
+    }
+
+    PyMem_Free(work);
+    Py_DECREF(sequence);
+    return result;
+}
+
+static PyMethodDef methods[] = {
+    { "strip", (PyCFunction)(void (*)(void))py_strip, METH_VARARGS | METH_KEYWORDS,
+      "strip(data, engine='reference') -> bytes\n\n"
+      "Strip TypeScript types from str (as UTF-8) or a bytes-like object." },
+    { "strip_many", (PyCFunction)(void (*)(void))py_strip_many, METH_VARARGS | METH_KEYWORDS,
+      "strip_many(items, engine='reference', jobs=0) -> list of bytes\n\n"
+      "Strip every item in parallel without the GIL (jobs=0: one worker per CPU)." },
+    { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef module = {
+    PyModuleDef_HEAD_INIT, "ast_analyzer",
+    "TypeScript type stripper (engines: reference, fast, structural, threaded, auto).",
+    -1, methods, NULL, NULL, NULL, NULL
+};
+
+PyMODINIT_FUNC PyInit_ast_analyzer(void) {
+    return PyModule_Create(&module);
+}
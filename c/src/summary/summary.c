@@ -0,0 +1,169 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "summary.h"
+#include "../io/io.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static const char *stage_names[STAGE_COUNT] = { "read", "hash", "strip", "index", "write" };
+
+int summary_init(Summary *summary, size_t top) {
+    memset(summary, 0, sizeof(*summary));
+    summary->top = top;
+    if (top) {
+        summary->slowest = calloc(top, sizeof(SummaryFile));
+        summary->largest = calloc(top, sizeof(SummaryFile));
+        if (!summary->slowest || !summary->largest) {
+            free(summary->slowest);
+            free(summary->largest);
+            return -1;
+        }
+    }
+    pthread_mutex_init(&summary->lock, NULL);
+    return 0;
+}
+
+void summary_free(Summary *summary) {
+    for (size_t i = 0; i < summary->slowest_count; i++) free(summary->slowest[i].path);
+    for (size_t i = 0; i < summary->largest_count; i++) free(summary->largest[i].path);
+    free(summary->slowest);
+    free(summary->largest);
+    pthread_mutex_destroy(&summary->lock);
+}
+
+double summary_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+void summary_add_stage(Summary *summary, SummaryStage stage, double ms) {
+    pthread_mutex_lock(&summary->lock);
+    summary->stage_ms[stage] += ms;
+    pthread_mutex_unlock(&summary->lock);
+}
+
+static double file_ms(const SummaryFile *file) { return file->ms; }
+static double file_bytes(const SummaryFile *file) { return (double)file->bytes; }
+
+// Insert into a list kept sorted by key, dropping the smallest when full
+static void top_insert(SummaryFile *list, size_t *count, size_t top, const SummaryFile *file,
+                       double (*key)(const SummaryFile*)) {
+    size_t pos = *count;
+    while (pos > 0 && key(&list[pos - 1]) < key(file)) pos--;
+    if (pos >= top) return;
+
+    char *path = strdup(file->path);
+    if (!path) return;
+    if (*count == top) {
+        free(list[top - 1].path);
+        (*count)--;
+    }
+    memmove(&list[pos + 1], &list[pos], (*count - pos) * sizeof(SummaryFile));
+    list[pos] = *file;
+    list[pos].path = path;
+    (*count)++;
+}
+
+void summary_add_file(Summary *summary, const char *path, double ms, size_t bytes, size_t lines,
+                      size_t tokens) {
+    SummaryFile file = { (char*)path, ms, bytes, tokens };
+
+    pthread_mutex_lock(&summary->lock);
+    summary->lines += lines;
+    summary->tokens += tokens;
+    top_insert(summary->slowest, &summary->slowest_count, summary->top, &file, file_ms);
+    top_insert(summary->largest, &summary->largest_count, summary->top, &file, file_bytes);
+    pthread_mutex_unlock(&summary->lock);
+}
+
+static double ratio(double part, double whole) {
+    return whole > 0 ? part / whole : 0;
+}
+
+static void write_text(const Summary *s, FILE *file) {
+    double stage_total = 0;
+    for (int i = 0; i < STAGE_COUNT; i++) stage_total += s->stage_ms[i];
+
+    fprintf(file, "Summary:\n");
+    fprintf(file, "  files:        %zu (%zu stripped, %zu cached, %zu passed through, %zu failed)\n",
+            s->files, s->stripped, s->cache_hits, s->passed, s->failed);
+    fprintf(file, "  skipped:      %zu unresolved import(s)\n", s->skipped);
+    fprintf(file, "  bytes:        %zu in, %zu out (%zu lines in)\n", s->bytes_in, s->bytes_out, s->lines);
+    fprintf(file, "  cache hits:   %zu of %zu (%.1f%%)\n",
+            s->cache_hits, s->cache_lookups, 100 * ratio(s->cache_hits, s->cache_lookups));
+    fprintf(file, "  wall time:    %.3f ms\n", s->wall_ms);
+    fprintf(file, "  stage time (summed over threads):\n");
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        fprintf(file, "    %-6s %12.3f ms  %5.1f%%\n", stage_names[i], s->stage_ms[i],
+                100 * ratio(s->stage_ms[i], stage_total));
+    }
+
+    fprintf(file, "  slowest files:\n");
+    for (size_t i = 0; i < s->slowest_count; i++) {
+        const SummaryFile *f = &s->slowest[i];
+        fprintf(file, "    %10.3f ms %10zu B  %.2f tok/B  %s\n", f->ms, f->bytes,
+                ratio(f->tokens, f->bytes), f->path);
+    }
+    fprintf(file, "  largest files:\n");
+    for (size_t i = 0; i < s->largest_count; i++) {
+        const SummaryFile *f = &s->largest[i];
+        fprintf(file, "    %10zu B %10.3f ms  %.2f tok/B  %s\n", f->bytes, f->ms,
+                ratio(f->tokens, f->bytes), f->path);
+    }
+}
+
+static void write_file_list(FILE *file, const char *name, const SummaryFile *list, size_t count) {
+    fprintf(file, "  \"%s\": [", name);
+    for (size_t i = 0; i < count; i++) {
+        const SummaryFile *f = &list[i];
+        fprintf(file, "%s\n    {\"path\": ", i ? "," : "");
+        write_json_string(file, f->path, strlen(f->path));
+        fprintf(file, ", \"ms\": %.3f, \"bytes\": %zu, \"tokens\": %zu, \"tokensPerByte\": %.4f}",
+                f->ms, f->bytes, f->tokens, ratio(f->tokens, f->bytes));
+    }
+    fprintf(file, "%s]", count ? "\n  " : "");
+}
+
+static void write_json(const Summary *s, FILE *file) {
+    fprintf(file, "{\n");
+    fprintf(file, "  \"files\": %zu,\n  \"stripped\": %zu,\n  \"failed\": %zu,\n",
+            s->files, s->stripped, s->failed);
+    fprintf(file, "  \"passedThrough\": %zu,\n  \"skipped\": %zu,\n", s->passed, s->skipped);
+    fprintf(file, "  \"cacheLookups\": %zu,\n  \"cacheHits\": %zu,\n  \"cacheHitRatio\": %.4f,\n",
+            s->cache_lookups, s->cache_hits, ratio(s->cache_hits, s->cache_lookups));
+    fprintf(file, "  \"bytesIn\": %zu,\n  \"bytesOut\": %zu,\n  \"linesIn\": %zu,\n  \"tokens\": %zu,\n",
+            s->bytes_in, s->bytes_out, s->lines, s->tokens);
+    fprintf(file, "  \"wallMs\": %.3f,\n  \"stageMs\": {", s->wall_ms);
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        fprintf(file, "%s\"%s\": %.3f", i ? ", " : "", stage_names[i], s->stage_ms[i]);
+    }
+    fprintf(file, "},\n");
+    write_file_list(file, "slowest", s->slowest, s->slowest_count);
+    fprintf(file, ",\n");
+    write_file_list(file, "largest", s->largest, s->largest_count);
+    fprintf(file, "\n}\n");
+}
+
+int summary_write(const Summary *summary, const char *filepath) {
+    size_t length = strlen(filepath);
+    int json = length >= 5 && strcmp(filepath + length - 5, ".json") == 0;
+    FILE *file = strcmp(filepath, "-") == 0 ? stdout : fopen(filepath, "w");
+    if (!file) {
+        fprintf(stderr, "Error: Cannot open file '%s' for writing\n", filepath);
+        return -1;
+    }
+
+    if (json) {
+        write_json(summary, file);
+    } else {
+        write_text(summary, file);
+    }
+
+    if (file != stdout) {
+        fclose(file);
+    }
+    return 0;
+}
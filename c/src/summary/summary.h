@@ -0,0 +1,66 @@
+#ifndef SUMMARY_H
+#define SUMMARY_H
+
+#include <stddef.h>
+#include <pthread.h>
+
+// Default length of the slowest/largest file lists
+#define SUMMARY_DEFAULT_TOP 10
+
+// Pipeline stages timed across all worker threads
+typedef enum {
+    STAGE_READ,              // Reading inputs
+    STAGE_HASH,              // Content hashing for deduplication
+    STAGE_STRIP,             // Lexing and stripping
+    STAGE_INDEX,             // Export index collection
+    STAGE_WRITE,             // Writing outputs
+    STAGE_COUNT
+} SummaryStage;
+
+// One entry of a top-N list
+typedef struct {
+    char *path;
+    double ms;               // Strip (and index) time
+    size_t bytes;            // Input size
+    size_t tokens;           // Tokens lexed
+} SummaryFile;
+
+// Report of one batch or tar run; the run fills it in, the caller prints it
+typedef struct {
+    pthread_mutex_t lock;
+    size_t top;              // Capacity of each list
+    double stage_ms[STAGE_COUNT];
+    double wall_ms;
+    size_t files;            // Files (or tar members) handled
+    size_t stripped;         // Stripped by this run
+    size_t failed;
+    size_t cache_lookups;    // Inputs checked against earlier results
+    size_t cache_hits;       // Served from an identical input's result
+    size_t skipped;          // Imports that resolved to no file (crawl mode)
+    size_t passed;           // Copied through unchanged (tar members with no TypeScript)
+    size_t bytes_in;
+    size_t bytes_out;
+    size_t lines;            // Input lines
+    size_t tokens;
+    SummaryFile *slowest;    // Sorted, slowest first
+    size_t slowest_count;
+    SummaryFile *largest;    // Sorted, largest first
+    size_t largest_count;
+} Summary;
+
+int summary_init(Summary *summary, size_t top);
+void summary_free(Summary *summary);
+
+// Monotonic clock in milliseconds for stage timing
+double summary_now_ms(void);
+
+// Thread-safe accumulation
+void summary_add_stage(Summary *summary, SummaryStage stage, double ms);
+void summary_add_file(Summary *summary, const char *path, double ms, size_t bytes, size_t lines,
+                      size_t tokens);
+
+// Write the report: JSON when filepath ends in ".json", text otherwise
+// ("-" prints text to stdout)
+int summary_write(const Summary *summary, const char *filepath);
+
+#endif // SUMMARY_H
@@ -0,0 +1,689 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "tar.h"
+#include "../analyzer/analyzer.h"
+#include "../analyzer/engine.h"
+#include "../cache/cache.h"
+#include "../io/io.h"
+#include "../pool/pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+// ustar header fields (offset, length)
+#define TAR_NAME_OFFSET     0
+#define TAR_NAME_LENGTH     100
+#define TAR_SIZE_OFFSET     124
+#define TAR_SIZE_LENGTH     12
+#define TAR_CHKSUM_OFFSET   148
+#define TAR_CHKSUM_LENGTH   8
+#define TAR_TYPE_OFFSET     156
+#define TAR_MAGIC_OFFSET    257
+#define TAR_PREFIX_OFFSET   345
+#define TAR_PREFIX_LENGTH   155
+
+// Members kept whole in memory at most this large; bigger pass-through
+// members are copied straight from input to output
+#define TAR_DIRECT_COPY_SIZE ((size_t)(MAX_FILE_SIZE))
+
+// One archive member on its way from the reader to the writer
+typedef struct TarEntry {
+    struct TarContext *ctx;
+    char *name;              // Member path (for messages)
+    char *meta;              // Metadata blocks (GNU long names, pax) and the member header
+    size_t meta_size;
+    char *data;              // Member contents, NUL-terminated, without padding
+    size_t data_size;
+    int strip;
+    const char *refused;     // Why a .ts member is copied unchanged (counted as failed)
+    int done;                // Ready to be written
+    char *result;            // Stripped contents (strip members that succeeded)
+    size_t result_size;
+} TarEntry;
+
+typedef struct TarContext {
+    const TarOptions *options;
+    ThreadPool *pool;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;  // An entry was queued, finished or written
+    TarEntry ring[TAR_WINDOW_ENTRIES];
+    size_t head;             // Next entry to write (counters grow without wrapping)
+    size_t tail;             // Next free slot
+    size_t window_bytes;
+    int eof;                 // Reader is done queueing
+    int write_error;
+    TarStats stats;
+} TarContext;
+
+// ============================================================================
+// Block I/O
+// ============================================================================
+
+// Time since start, charged to stage when a summary is collected
+static void tar_stage(const TarContext *ctx, SummaryStage stage, double start) {
+    if (ctx->options->summary) {
+        summary_add_stage(ctx->options->summary, stage, summary_now_ms() - start);
+    }
+}
+
+// Read up to size bytes; returns the count read (short only at end of input)
+static ssize_t read_full(int fd, void *buffer, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        ssize_t got = read(fd, (char*)buffer + done, size - done);
+        if (got < 0 && errno == EINTR) continue;
+        if (got < 0) return -1;
+        if (got == 0) break;
+        done += got;
+    }
+    return done;
+}
+
+static int write_full(int fd, const void *buffer, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        ssize_t put = write(fd, (const char*)buffer + done, size - done);
+        if (put < 0 && errno == EINTR) continue;
+        if (put <= 0) return -1;
+        done += put;
+    }
+    return 0;
+}
+
+static size_t padded_size(size_t size) {
+    return (size + TAR_BLOCK_SIZE - 1) / TAR_BLOCK_SIZE * TAR_BLOCK_SIZE;
+}
+
+// Write zero padding after size bytes of member data
+static int write_padding(int fd, size_t size) {
+    static const char zeros[TAR_BLOCK_SIZE];
+    size_t pad = padded_size(size) - size;
+    return pad ? write_full(fd, zeros, pad) : 0;
+}
+
+// ============================================================================
+// Headers
+// ============================================================================
+
+// Octal, or base-256 when the top bit of the first byte is set (GNU)
+static long long parse_number(const char *field, size_t length) {
+    const unsigned char *p = (const unsigned char*)field;
+    long long value = 0;
+
+    if (p[0] & 0x80) {
+        value = p[0] & 0x3f;
+        for (size_t i = 1; i < length; i++) {
+            if (value > (1LL << 54)) return -1;
+            value = (value << 8) | p[i];
+        }
+        return value;
+    }
+
+    size_t i = 0;
+    while (i < length && p[i] == ' ') i++;
+    for (; i < length && p[i] >= '0' && p[i] <= '7'; i++) {
+        value = value * 8 + (p[i] - '0');
+    }
+    return value;
+}
+
+static unsigned header_sum(const unsigned char *block) {
+    unsigned sum = 0;
+    for (size_t i = 0; i < TAR_BLOCK_SIZE; i++) {
+        int in_checksum = i >= TAR_CHKSUM_OFFSET && i < TAR_CHKSUM_OFFSET + TAR_CHKSUM_LENGTH;
+        sum += in_checksum ? ' ' : block[i];
+    }
+    return sum;
+}
+
+static int header_valid(const char *block) {
+    return parse_number(block + TAR_CHKSUM_OFFSET, TAR_CHKSUM_LENGTH) ==
+           (long long)header_sum((const unsigned char*)block);
+}
+
+static int block_is_zero(const char *block) {
+    for (size_t i = 0; i < TAR_BLOCK_SIZE; i++) {
+        if (block[i]) return 0;
+    }
+    return 1;
+}
+
+// Give a member header a new size and checksum
+static void header_set_size(char *block, size_t size) {
+    char field[TAR_SIZE_LENGTH + 1];
+    snprintf(field, sizeof(field), "%011lo", (unsigned long)size);
+    memcpy(block + TAR_SIZE_OFFSET, field, TAR_SIZE_LENGTH);
+
+    snprintf(field, sizeof(field), "%06o", header_sum((const unsigned char*)block));
+    memcpy(block + TAR_CHKSUM_OFFSET, field, 7);
+    block[TAR_CHKSUM_OFFSET + 7] = ' ';
+}
+
+static char* header_name(const char *block) {
+    size_t name_length = strnlen(block + TAR_NAME_OFFSET, TAR_NAME_LENGTH);
+    size_t prefix_length = 0;
+    if (memcmp(block + TAR_MAGIC_OFFSET, "ustar", 5) == 0) {
+        prefix_length = strnlen(block + TAR_PREFIX_OFFSET, TAR_PREFIX_LENGTH);
+    }
+
+    char *name = malloc(prefix_length + name_length + 2);
+    if (!name) return NULL;
+    size_t n = 0;
+    if (prefix_length) {
+        memcpy(name, block + TAR_PREFIX_OFFSET, prefix_length);
+        n = prefix_length;
+        name[n++] = '/';
+    }
+    memcpy(name + n, block + TAR_NAME_OFFSET, name_length);
+    name[n + name_length] = '\0';
+    return name;
+}
+
+// Pull path and size records out of a pax extended header
+static void pax_scan(const char *data, size_t size, char **path, int *has_size) {
+    const char *p = data;
+    const char *end = data + size;
+    while (p < end) {
+        char *space;
+        long length = strtol(p, &space, 10);
+        if (length <= 0 || *space != ' ' || length > end - p) return;
+
+        const char *key = space + 1;
+        const char *record_end = p + length - 1;  // Trailing newline
+        const char *equals = memchr(key, '=', record_end - key);
+        if (equals) {
+            size_t key_length = equals - key;
+            if (key_length == 4 && memcmp(key, "path", 4) == 0) {
+                free(*path);
+                *path = strndup(equals + 1, record_end - equals - 1);
+            } else if (key_length == 4 && memcmp(key, "size", 4) == 0) {
+                *has_size = 1;
+            }
+        }
+        p += length;
+    }
+}
+
+static int is_strippable(const char *name) {
+    size_t length = strlen(name);
+    if (length >= 5 && strcmp(name + length - 5, ".d.ts") == 0) return 0;
+    return (length >= 3 && strcmp(name + length - 3, ".ts") == 0) ||
+           (length >= 4 && strcmp(name + length - 4, ".tsx") == 0);
+}
+
+// ============================================================================
+// Workers
+// ============================================================================
+
+static void tar_strip_job(void *arg) {
+    TarEntry *entry = arg;
+    TarContext *ctx = entry->ctx;
+
+    const char *cache_dir = ctx->options->cache_dir;
+    RemoteCache *remote = ctx->options->remote;
+    Summary *summary = ctx->options->summary;
+    AST *ast = NULL;
+    char *result = NULL;
+    size_t tokens = 0;
+    int hit = 0;
+
+    // Invalid members are reported and copied unchanged; members with no
+    // TypeScript in them pass through without being lexed
+    InputScan scan;
+    double start = summary_now_ms();
+    int valid = input_check(entry->name, entry->data, entry->data_size, ctx->options->bom, &scan) == 0;
+    int plain = valid && scan.plain && scan.skip == 0;
+    tar_stage(ctx, STAGE_READ, start);
+    const char *data = entry->data + (valid ? scan.skip : 0);
+    size_t size = entry->data_size - (valid ? scan.skip : 0);
+
+    unsigned char digest[SHA256_SIZE];
+    start = summary_now_ms();
+    if (valid && !plain && (cache_dir || remote)) {
+        sha256(data, size, digest);
+        tar_stage(ctx, STAGE_HASH, start);
+        start = summary_now_ms();
+
+        // Local plans first; one fetched from the remote is kept locally too
+        EditPlan plan;
+        int found = cache_dir && plan_load(cache_dir, digest, &plan) == 0;
+        if (!found && remote) {
+            found = remote_lookup_finish(remote, remote_lookup(remote, digest, size), &plan) == 0;
+            if (found && cache_dir) plan_store(cache_dir, digest, &plan);
+        }
+        if (found) {
+            result = plan_apply(&plan, data, size);
+            tokens = plan.token_count;
+            hit = result != NULL;
+            plan_free(&plan);
+        }
+    }
+    if (valid && !plain && !hit) {
+        double strip_start = summary_now_ms();
+        result = size ? engine_strip(data, size, summary || cache_dir || remote ? &ast : NULL) : strdup("");
+        tokens = ast ? ast->count : 0;
+        remote_note_strip(remote, size, summary_now_ms() - strip_start);
+    }
+    double ms = summary_now_ms() - start;
+
+    EditPlan plan;
+    if (!hit && result && (cache_dir || remote) &&
+        plan_build(data, size, result, strlen(result), &plan) == 0) {
+        plan.token_count = tokens;
+        if (plan_set_deps(&plan, data, ast ? ast->deps : NULL, ast ? ast->dep_count : 0) == 0) {
+            if (cache_dir) plan_store(cache_dir, digest, &plan);
+            if (remote) remote_store(remote, digest, &plan);
+        }
+        plan_free(&plan);
+    }
+    ast_free(ast);
+    if (summary) {
+        summary_add_stage(summary, STAGE_STRIP, ms);
+        if (result) summary_add_file(summary, entry->name, ms, size, scan.lines, tokens);
+    }
+
+    pthread_mutex_lock(&ctx->lock);
+    entry->result = result;
+    entry->result_size = result ? strlen(result) : 0;
+    if (plain) entry->strip = 0;
+    entry->done = 1;
+    if (hit) ctx->stats.cache_hits++;
+    pthread_cond_broadcast(&ctx->changed);
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+// Write one entry; stripped members get a rewritten header
+static int write_entry(TarContext *ctx, TarEntry *entry) {
+    int fd = ctx->options->output_fd;
+    const char *data = entry->data;
+    size_t size = entry->data_size;
+
+    if (entry->strip && entry->result) {
+        data = entry->result;
+        size = entry->result_size;
+        header_set_size(entry->meta + entry->meta_size - TAR_BLOCK_SIZE, size);
+    }
+
+    if (write_full(fd, entry->meta, entry->meta_size) != 0 ||
+        write_full(fd, data, size) != 0 ||
+        write_padding(fd, size) != 0) {
+        return -1;
+    }
+    ctx->stats.bytes_out += entry->meta_size + padded_size(size);
+    return 0;
+}
+
+static void entry_free(TarEntry *entry) {
+    free(entry->name);
+    free(entry->meta);
+    free(entry->data);
+    free(entry->result);
+    memset(entry, 0, sizeof(*entry));
+}
+
+// Write finished entries in archive order, then the end-of-archive marker
+static void* tar_writer(void *arg) {
+    TarContext *ctx = arg;
+
+    pthread_mutex_lock(&ctx->lock);
+    for (;;) {
+        while (!(ctx->head < ctx->tail && ctx->ring[ctx->head % TAR_WINDOW_ENTRIES].done) &&
+               !(ctx->eof && ctx->head == ctx->tail)) {
+            pthread_cond_wait(&ctx->changed, &ctx->lock);
+        }
+        if (ctx->head == ctx->tail) break;
+
+        TarEntry *entry = &ctx->ring[ctx->head % TAR_WINDOW_ENTRIES];
+        int write_error = ctx->write_error;
+        pthread_mutex_unlock(&ctx->lock);
+
+        // After a write error keep draining so the reader never blocks
+        double start = summary_now_ms();
+        int failed = !write_error && write_entry(ctx, entry) != 0;
+        tar_stage(ctx, STAGE_WRITE, start);
+        if (entry->strip && !entry->result) {
+            fprintf(stderr, "Error: Type stripping failed for '%s'; copied unchanged\n", entry->name);
+        }
+        if (entry->refused) {
+            fprintf(stderr, "Error: Cannot strip '%s' (%s); copied unchanged\n", entry->name, entry->refused);
+        }
+
+        pthread_mutex_lock(&ctx->lock);
+        if (entry->strip) {
+            if (entry->result) ctx->stats.stripped++; else ctx->stats.failed++;
+        } else if (entry->refused) {
+            ctx->stats.failed++;
+        } else {
+            ctx->stats.passed++;
+        }
+        if (failed) ctx->write_error = 1;
+        ctx->window_bytes -= entry->meta_size + entry->data_size;
+        entry_free(entry);
+        ctx->head++;
+        pthread_cond_broadcast(&ctx->changed);
+    }
+    pthread_mutex_unlock(&ctx->lock);
+    return NULL;
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+typedef struct {
+    char *meta;              // Blocks read for the current member so far
+    size_t meta_size;
+    size_t meta_capacity;
+    char *long_name;         // GNU 'L' name for the next member
+    char *pax_path;          // pax path= for the next member
+    int pax_size;            // pax header carries size= (not rewritten, so never stripped)
+} PendingMember;
+
+static int pending_append(PendingMember *pending, const char *data, size_t size) {
+    if (pending->meta_size + size > pending->meta_capacity) {
+        size_t capacity = pending->meta_capacity ? pending->meta_capacity * 2 : 2 * TAR_BLOCK_SIZE;
+        while (capacity < pending->meta_size + size) capacity *= 2;
+        char *meta = realloc(pending->meta, capacity);
+        if (!meta) return -1;
+        pending->meta = meta;
+        pending->meta_capacity = capacity;
+    }
+    memcpy(pending->meta + pending->meta_size, data, size);
+    pending->meta_size += size;
+    return 0;
+}
+
+static void pending_reset(PendingMember *pending) {
+    free(pending->meta);
+    free(pending->long_name);
+    free(pending->pax_path);
+    memset(pending, 0, sizeof(*pending));
+}
+
+// Wait until everything queued has been written
+static void drain_window(TarContext *ctx) {
+    pthread_mutex_lock(&ctx->lock);
+    while (ctx->head < ctx->tail) {
+        pthread_cond_wait(&ctx->changed, &ctx->lock);
+    }
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+// Copy a large pass-through member from input to output in chunks; a .ts
+// member copied for reason refused is reported and counted as failed
+static int copy_direct(TarContext *ctx, const PendingMember *pending, size_t size,
+                       const char *name, const char *refused) {
+    int in = ctx->options->input_fd;
+    int out = ctx->options->output_fd;
+    size_t remaining = padded_size(size);
+    char buffer[64 * 1024];
+
+    drain_window(ctx);
+    if (refused) {
+        fprintf(stderr, "Error: Cannot strip '%s' (%s); copied unchanged\n", name, refused);
+    }
+
+    // Charged to the write stage as a whole
+    double start = summary_now_ms();
+    int status = ctx->write_error ? -1 : write_full(out, pending->meta, pending->meta_size);
+    ctx->stats.bytes_out += pending->meta_size;
+    while (remaining > 0) {
+        size_t chunk = remaining < sizeof(buffer) ? remaining : sizeof(buffer);
+        if (read_full(in, buffer, chunk) != (ssize_t)chunk) {
+            fprintf(stderr, "Error: Truncated tar member\n");
+            tar_stage(ctx, STAGE_WRITE, start);
+            return -1;
+        }
+        if (status == 0) status = write_full(out, buffer, chunk);
+        ctx->stats.bytes_in += chunk;
+        ctx->stats.bytes_out += chunk;
+        remaining -= chunk;
+    }
+    tar_stage(ctx, STAGE_WRITE, start);
+    pthread_mutex_lock(&ctx->lock);
+    if (refused) ctx->stats.failed++; else ctx->stats.passed++;
+    if (status != 0) ctx->write_error = 1;
+    pthread_mutex_unlock(&ctx->lock);
+    return status;
+}
+
+// Hand an entry to the writer (and a worker if it needs stripping)
+static int queue_entry(TarContext *ctx, TarEntry *entry) {
+    size_t bytes = entry->meta_size + entry->data_size;
+
+    pthread_mutex_lock(&ctx->lock);
+    while (ctx->tail - ctx->head >= TAR_WINDOW_ENTRIES ||
+           (ctx->head < ctx->tail && ctx->window_bytes + bytes > TAR_WINDOW_BYTES)) {
+        pthread_cond_wait(&ctx->changed, &ctx->lock);
+    }
+    TarEntry *slot = &ctx->ring[ctx->tail % TAR_WINDOW_ENTRIES];
+    *slot = *entry;
+    slot->ctx = ctx;
+    slot->done = !slot->strip;
+    ctx->window_bytes += bytes;
+    ctx->tail++;
+    int write_error = ctx->write_error;
+    pthread_cond_broadcast(&ctx->changed);
+    pthread_mutex_unlock(&ctx->lock);
+
+    // A pass-through slot may already be written and reused here; use the copy
+    if (entry->strip && pool_submit(ctx->pool, tar_strip_job, slot) != 0) {
+        // Fall back to copying the member unchanged
+        pthread_mutex_lock(&ctx->lock);
+        slot->done = 1;
+        pthread_cond_broadcast(&ctx->changed);
+        pthread_mutex_unlock(&ctx->lock);
+    }
+    return write_error ? -1 : 0;
+}
+
+static int read_archive(TarContext *ctx) {
+    int in = ctx->options->input_fd;
+    char block[TAR_BLOCK_SIZE];
+    PendingMember pending = {0};
+    int status = 0;
+
+    for (;;) {
+        double start = summary_now_ms();
+        ssize_t got = read_full(in, block, TAR_BLOCK_SIZE);
+        tar_stage(ctx, STAGE_READ, start);
+        if (got == 0 && pending.meta_size == 0) break;  // No end marker; accept
+        if (got != TAR_BLOCK_SIZE) {
+            fprintf(stderr, "Error: Truncated tar archive\n");
+            status = -1;
+            break;
+        }
+        ctx->stats.bytes_in += TAR_BLOCK_SIZE;
+        if (block_is_zero(block)) break;  // End of archive
+
+        if (!header_valid(block)) {
+            fprintf(stderr, "Error: Invalid tar header checksum at byte %zu\n",
+                    ctx->stats.bytes_in - TAR_BLOCK_SIZE);
+            status = -1;
+            break;
+        }
+
+        char type = block[TAR_TYPE_OFFSET];
+        long long size = parse_number(block + TAR_SIZE_OFFSET, TAR_SIZE_LENGTH);
+        if (size < 0 || pending_append(&pending, block, TAR_BLOCK_SIZE) != 0) {
+            status = -1;
+            break;
+        }
+
+        // Metadata headers describe the member that follows them
+        if (type == 'L' || type == 'K' || type == 'x') {
+            size_t padded = padded_size(size);
+            if ((size_t)size > TAR_DIRECT_COPY_SIZE) {
+                status = -1;
+                break;
+            }
+            char *data = malloc(padded + 1);
+            start = summary_now_ms();
+            int complete = data && read_full(in, data, padded) == (ssize_t)padded;
+            tar_stage(ctx, STAGE_READ, start);
+            if (!complete) {
+                fprintf(stderr, "Error: Truncated tar archive\n");
+                free(data);
+                status = -1;
+                break;
+            }
+            data[size] = '\0';
+            ctx->stats.bytes_in += padded;
+            if (type == 'L') {
+                free(pending.long_name);
+                pending.long_name = strdup(data);
+            } else if (type == 'x') {
+                pax_scan(data, size, &pending.pax_path, &pending.pax_size);
+            }
+            int appended = pending_append(&pending, data, padded);
+            free(data);
+            if (appended != 0) {
+                status = -1;
+                break;
+            }
+            continue;
+        }
+
+        ctx->stats.entries++;
+        char *name = pending.long_name ? strdup(pending.long_name)
+                   : pending.pax_path ? strdup(pending.pax_path)
+                   : header_name(block);
+        int regular = type == '0' || type == '\0' || type == '7';
+        // A pax size= record is not rewritten, so such members keep their size
+        int strippable = regular && name && is_strippable(name);
+        const char *refused = !strippable ? NULL
+                            : (size_t)size > MAX_FILE_SIZE ? "too large"
+                            : pending.pax_size ? "size set by a pax header" : NULL;
+        int strip = strippable && !refused;
+
+        if (!strip && (size_t)size > TAR_DIRECT_COPY_SIZE) {
+            int copied = copy_direct(ctx, &pending, size, name, refused);
+            free(name);
+            if (copied != 0) {
+                status = -1;
+                break;
+            }
+            pending_reset(&pending);
+            continue;
+        }
+
+        size_t padded = padded_size(size);
+        char *data = malloc(padded + 1);
+        start = summary_now_ms();
+        int complete = data && read_full(in, data, padded) == (ssize_t)padded;
+        tar_stage(ctx, STAGE_READ, start);
+        if (!complete) {
+            fprintf(stderr, "Error: Truncated tar archive\n");
+            free(data);
+            free(name);
+            status = -1;
+            break;
+        }
+        data[size] = '\0';
+        ctx->stats.bytes_in += padded;
+
+        TarEntry entry = {0};
+        entry.name = name;
+        entry.meta = pending.meta;
+        entry.meta_size = pending.meta_size;
+        entry.data = data;
+        entry.data_size = size;
+        entry.strip = strip;
+        entry.refused = refused;
+        pending.meta = NULL;
+        pending_reset(&pending);
+
+        if (queue_entry(ctx, &entry) != 0) {
+            status = -1;
+            break;
+        }
+    }
+
+    pending_reset(&pending);
+    return status;
+}
+
+// ============================================================================
+// Driver
+// ============================================================================
+
+int tar_run(const TarOptions *options, TarStats *stats) {
+    TarContext *ctx = calloc(1, sizeof(TarContext));
+    if (!ctx) return -1;
+    ctx->options = options;
+    pthread_mutex_init(&ctx->lock, NULL);
+    pthread_cond_init(&ctx->changed, NULL);
+
+    // Jobs never block on I/O, so one worker per CPU is enough
+    ctx->pool = pool_create(options->jobs > 0 ? options->jobs : pool_default_workers());
+    pthread_t writer;
+    if (!ctx->pool || pthread_create(&writer, NULL, tar_writer, ctx) != 0) {
+        fprintf(stderr, "Error: Cannot start worker threads\n");
+        pool_destroy(ctx->pool);
+        pthread_cond_destroy(&ctx->changed);
+        pthread_mutex_destroy(&ctx->lock);
+        free(ctx);
+        return -1;
+    }
+
+    Jobserver *jobserver = options->jobserver ? jobserver_from_env() : NULL;
+    if (jobserver) {
+        pool_use_jobserver(ctx->pool, jobserver);
+    }
+
+    int status = read_archive(ctx);
+
+    pthread_mutex_lock(&ctx->lock);
+    ctx->eof = 1;
+    pthread_cond_broadcast(&ctx->changed);
+    pthread_mutex_unlock(&ctx->lock);
+    pthread_join(writer, NULL);
+    pool_wait(ctx->pool);
+    pool_destroy(ctx->pool);
+    jobserver_close(jobserver);
+
+    // End of archive: two zero blocks, padded to a whole record
+    if (!ctx->write_error) {
+        static const char zeros[TAR_RECORD_SIZE];
+        size_t end = ctx->stats.bytes_out + 2 * TAR_BLOCK_SIZE;
+        size_t record_pad = (TAR_RECORD_SIZE - end % TAR_RECORD_SIZE) % TAR_RECORD_SIZE;
+        if (write_full(options->output_fd, zeros, 2 * TAR_BLOCK_SIZE + record_pad) != 0) {
+            ctx->write_error = 1;
+        } else {
+            ctx->stats.bytes_out = end + record_pad;
+        }
+    }
+    if (ctx->write_error) {
+        fprintf(stderr, "Error: Cannot write tar output\n");
+        status = -1;
+    }
+    if (ctx->stats.failed) {
+        status = -1;
+    }
+
+    if (options->summary) {
+        Summary *summary = options->summary;
+        summary->files = ctx->stats.entries;
+        summary->stripped = ctx->stats.stripped;
+        summary->passed = ctx->stats.passed;
+        summary->failed = ctx->stats.failed;
+        if (options->cache_dir || options->remote) {
+            summary->cache_lookups = ctx->stats.stripped + ctx->stats.failed;
+            summary->cache_hits = ctx->stats.cache_hits;
+            summary->stripped -= ctx->stats.cache_hits;
+        }
+        summary->bytes_in = ctx->stats.bytes_in;
+        summary->bytes_out = ctx->stats.bytes_out;
+    }
+
+    if (stats) {
+        *stats = ctx->stats;
+    }
+    pthread_cond_destroy(&ctx->changed);
+    pthread_mutex_destroy(&ctx->lock);
+    free(ctx);
+    return status;
+}
@@ -0,0 +1,46 @@
+#ifndef TAR_H
+#define TAR_H
+
+#include <stddef.h>
+#include "../analyzer/input.h"
+#include "../cache/remote.h"
+#include "../summary/summary.h"
+
+#define TAR_BLOCK_SIZE   512
+#define TAR_RECORD_SIZE  (20 * TAR_BLOCK_SIZE)   // Output is padded to whole records
+
+// Entries in flight between the reader and the writer
+#define TAR_WINDOW_ENTRIES 1024
+#define TAR_WINDOW_BYTES   (64u * 1024 * 1024)
+
+// Options for stripping a tar stream
+typedef struct {
+    int input_fd;            // Archive to read (ustar, GNU or pax)
+    int output_fd;           // Archive to write
+    int jobs;                // Worker threads (<= 0: one per usable CPU)
+    int jobserver;           // Share make's job slots when MAKEFLAGS advertises a jobserver
+    Summary *summary;        // Stage times and top members go here (NULL: not collected)
+    const char *cache_dir;   // Edit-plan cache keyed by content hash (NULL: none)
+    RemoteCache *remote;     // Shared edit-plan cache behind cache_dir (NULL: none)
+    BomMode bom;             // Keep or drop a leading UTF-8 BOM
+} TarOptions;
+
+// Counters filled in by tar_run()
+typedef struct {
+    size_t entries;          // Archive members (metadata headers count with their member)
+    size_t stripped;         // .ts/.tsx members replaced by their stripped text
+    size_t passed;           // Members copied unchanged (not .ts, or no TypeScript inside)
+    size_t failed;           // Members that could not be stripped (copied unchanged)
+    size_t cache_hits;       // Members rebuilt from a cached edit plan
+    size_t bytes_in;
+    size_t bytes_out;
+} TarStats;
+
+// Read a tar stream, strip .ts/.tsx members on the worker pool (declaration
+// files and everything else pass through), and write a tar stream with the
+// members in their original order. Nothing touches the filesystem.
+// Returns 0 on success, -1 on a malformed archive, an I/O error or a member
+// that could not be stripped
+int tar_run(const TarOptions *options, TarStats *stats);
+
+#endif // TAR_H
@@ -0,0 +1,41 @@
+/* Colons that are not annotations, next to ones that are */
+
+/* Ternaries */
+const sign = (n) => n < 0 ? "-" : n > 0 ? "+" : "";
+let pick = flag ? left : right;
+
+/* Object literal properties */
+function make(id, label) {
+  return { id: id, label: label, nested: { depth: 1 } };
+}
+const config = {
+  retries: 3,
+  onError: (err) => { console.log(err); },
+};
+
+/* Case and default labels */
+function describe(kind) {
+  switch (kind) {
+    case "a": return "first";
+    case LIMIT: return "limit";
+    default: return "other";
+  }
+}
+
+/* Statement labels */
+outer: for (let i = 0; i < 3; i++) {
+  inner: for (const j of list) {
+    if (j) continue outer;
+    break inner;
+  }
+}
+
+/* Optional members and parameters */
+
+class Widget {
+  title;
+  resize(width, height) {}
+}
+function greet(name, punctuation) {
+  return name;
+}
@@ -0,0 +1,2 @@
+{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}
+if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {if (a) {}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}
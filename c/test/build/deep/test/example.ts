@@ -0,0 +1,62 @@
+// TypeScript example file
+
+
+
+
+
+const MAX_USERS = 100;
+const MIN_AGE = 18;
+
+let defaultGreeting = "Hello";
+
+function createUser(id, name, email) {
+  return {
+    id: id,
+    name: name,
+    email: email,
+  };
+}
+
+function greetUser(user) {
+  return `${defaultGreeting}, ${user.name}!`;
+}
+
+function formatEmail(email) {
+  return email.toLowerCase();
+}
+
+function validateAge(age) {
+  return age >= MIN_AGE;
+}
+
+class UserManager   {
+   users = [];
+
+  constructor( maxUsers = MAX_USERS) {}
+
+  addUser(user) {
+    if (this.users.length < this.maxUsers) {
+      this.users.push(user);
+    }
+  }
+
+  greet(name) {
+    return `Hello, ${name}!`;
+  }
+
+  getUser(id) {
+    return this.users.find((u) => u.id === id);
+  }
+}
+
+// Generic functionfunction identity(arg) {
+  return arg;
+}
+
+// Arrow function with typesconst add = (a, b) => a + b;
+
+// Union typesfunction process(value) {
+  console.log(value);
+}
+
+export { User, UserRole, createUser, UserManager };
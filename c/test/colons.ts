@@ -0,0 +1,43 @@
+/* Colons that are not annotations, next to ones that are */
+
+/* Ternaries */
+const sign = (n: number): string => n < 0 ? "-" : n > 0 ? "+" : "";
+let pick = flag ? left : right;
+
+/* Object literal properties */
+function make(id: number, label: string) {
+  return { id: id, label: label, nested: { depth: 1 } };
+}
+const config = {
+  retries: 3,
+  onError: (err: Error): void => { console.log(err); },
+};
+
+/* Case and default labels */
+function describe(kind: string): string {
+  switch (kind) {
+    case "a": return "first";
+    case LIMIT: return "limit";
+    default: return "other";
+  }
+}
+
+/* Statement labels */
+outer: for (let i: number = 0; i < 3; i++) {
+  inner: for (const j of list) {
+    if (j) continue outer;
+    break inner;
+  }
+}
+
+/* Optional members and parameters */
+interface Options {
+  name?: string;
+}
+class Widget {
+  title?: string;
+  resize(width?: number, height?: number): void {}
+}
+function greet(name?: string, punctuation?: string) {
+  return name;
+}
@@ -0,0 +1,32 @@
+/* Annotation types that skip_type() has to step over */
+
+/* Object types */
+let point = { x: 1, y: 2 };
+function area(box) {
+  return box.width * box.height;
+}
+
+/* Function types */
+let handler = null;
+const compose = (f, g) => (x) => f(g(x));
+let factory = Object;
+
+/* Tuple and array types */
+let pair = ["a", 1];
+let grid = [[1, 2], [3, 4]];
+let rest = ["b", 2, 3];
+
+/* Generic, conditional and mapped types */
+let lookup = new Map();
+let unwrap = value;
+let frozen = point;
+let keys = "x";
+
+/* Multi-line unions and intersections */
+let state = "idle";
+let both = { name: "c", age: 3 };
+
+/* Defaults and trailing blanks stay */
+function scale(factor = 2, offset = 0) {
+  return factor + offset;
+}
@@ -0,0 +1,36 @@
+/* Annotation types that skip_type() has to step over */
+
+/* Object types */
+let point: { x: number; y: number } = { x: 1, y: 2 };
+function area(box: { width: number, height: number }): number {
+  return box.width * box.height;
+}
+
+/* Function types */
+let handler: (event: string, code: number) => void = null;
+const compose = (f: (a: number) => number, g: (b: number) => number) => (x: number) => f(g(x));
+let factory: new (name: string) => object = Object;
+
+/* Tuple and array types */
+let pair: [string, number] = ["a", 1];
+let grid: number[][] = [[1, 2], [3, 4]];
+let rest: [first: string, ...others: number[]] = ["b", 2, 3];
+
+/* Generic, conditional and mapped types */
+let lookup: Map<string, Array<number>> = new Map();
+let unwrap: T extends Promise<infer U> ? U : T = value;
+let frozen: { readonly [K in keyof Point]?: Point[K] } = point;
+let keys: keyof typeof point = "x";
+
+/* Multi-line unions and intersections */
+let state:
+  | "idle"
+  | "loading"
+  | "done" = "idle";
+let both: Named &
+  Aged = { name: "c", age: 3 };
+
+/* Defaults and trailing blanks stay */
+function scale(factor: number = 2, offset: number = 0): number {
+  return factor + offset;
+}